@@ -0,0 +1,49 @@
+// Copyright (c) 2026 KiraFlux
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#pragma once
+
+#include <Arduino.h>// for millis, delay
+
+#include <kf/math/units.hpp>
+
+// Session replay, soak runs and the power check drive time themselves
+#if (defined(DJC_SESSION_REPLAY) or defined(DJC_SOAK_TEST) or defined(DJC_POWER_CHECK)) and not defined(DJC_VIRTUAL_CLOCK)
+#define DJC_VIRTUAL_CLOCK
+#endif
+
+namespace djc {
+
+/// @brief Firmware time source
+/// @note With DJC_VIRTUAL_CLOCK time only moves when set or advanced explicitly
+struct Clock final {
+
+    [[nodiscard]] static kf::math::Milliseconds now() noexcept {
+#if defined(DJC_VIRTUAL_CLOCK)
+        return _virtual_now;
+#else
+        return millis();
+#endif
+    }
+
+    /// @brief Wait for given period (virtual clock advances instantly)
+    static void sleep(kf::math::Milliseconds period) noexcept {
+#if defined(DJC_VIRTUAL_CLOCK)
+        _virtual_now += period;
+#else
+        delay(period);
+#endif
+    }
+
+#if defined(DJC_VIRTUAL_CLOCK)
+    /// @brief Jump virtual time forward (never backwards)
+    static void set(kf::math::Milliseconds now) noexcept {
+        if (now > _virtual_now) { _virtual_now = now; }
+    }
+
+private:
+    inline static kf::math::Milliseconds _virtual_now{0};
+#endif
+};
+
+}// namespace djc
@@ -23,29 +23,24 @@ struct Config {
 
     using PeerFavoritesConfig = djc::memory::Box<PeerNote, kf::u8, 8>;
 
-    static constexpr auto latest_version{4};
-
-    kf::u16 version;
-
     Periphery::Config periphery;
     InputHandler::Config input_handler;
     Control::Config control;
     PeerFavoritesConfig peer_favorites;
+    Control::Profiles peer_profiles;
     kf::memory::Array<char, 16> device_name;
 
     [[nodiscard]] constexpr kf::memory::StringView deviceName() const noexcept {
         return kf::memory::StringView{device_name.data(), device_name.size()};
     }
 
-    [[nodiscard]] bool isLatestVersion() const noexcept { return version == latest_version; }
-
     static constexpr Config defaults() noexcept {
         return Config{
-            .version = latest_version,
             .periphery = Periphery::Config::defaults(),
             .input_handler = InputHandler::Config::defaults(),
             .control = Control::Config::defaults(),
             .peer_favorites = PeerFavoritesConfig::defaults(),
+            .peer_profiles = Control::Profiles::defaults(),
             .device_name = {"ESP32-DJC"},
         };
     }
@@ -4,63 +4,372 @@
 #pragma once
 
 #include <kf/Logger.hpp>
+#include <kf/aliases.hpp>
+#include <kf/math/units.hpp>
+#include <kf/memory/Array.hpp>
+#include <kf/memory/ArrayString.hpp>
+#include <kf/memory/Slice.hpp>
 #include <kf/memory/Storage.hpp>
+#include <kf/mixin/Initable.hpp>
 #include <kf/mixin/Singleton.hpp>
+#include <kf/mixin/TimedPollable.hpp>
 
+#include "djc/Clock.hpp"
 #include "djc/Config.hpp"
+#include "djc/ConfigMigrations.hpp"
+#include "djc/memory/CommitTask.hpp"
+#include "djc/memory/Migration.hpp"
+#include "djc/memory/SectionedStorage.hpp"
 
 namespace djc {
 
-struct ConfigManager final : kf::mixin::Singleton<ConfigManager> {
+/// @brief RAM config cache stored in NVS section by section
+/// @details Each section is versioned and checksummed on its own. Save writes only sections that differ from NVS.
+/// Load upgrades sections of older versions field by field (see ConfigMigrations.hpp), imports the pre-section
+/// config blob when no section exists yet, and falls back to defaults only for sections that cannot be recovered.
+/// Changes are committed in the background: modified(true) schedules a commit after a quiet period, edits made
+/// meanwhile are coalesced into it, and the NVS writes run in a low priority task on snapshots of the sections.
+/// Flash erase and write still turn the flash cache off on both cores, so commits are held while holdCommits() says so
+struct ConfigManager final : kf::mixin::Singleton<ConfigManager>, kf::mixin::TimedPollable<ConfigManager>, kf::mixin::Initable<ConfigManager, bool> {
 
-    [[nodiscard]] constexpr const Config &config() const noexcept { return _storage.config; }
+    enum class Section : kf::u8 {
+        Periphery,
+        InputHandler,
+        Control,
+        PeerFavorites,
+        Identity,
+        PeerProfiles,
+    };
+
+    static constexpr kf::u8 sections_total{6};
+
+    static constexpr kf::math::Milliseconds commit_delay{1500};     // quiet time before a commit
+    static constexpr kf::math::Milliseconds max_commit_delay{10000};// commit even while edits keep coming
+
+    /// @brief Background commit activity
+    struct CommitStats {
+        kf::u32 commits;
+        kf::u32 sections_written;
+        kf::u32 failures;
+        kf::u32 last_duration_us;// NVS time of the last commit, spent in the background task
+        kf::u32 max_snapshot_us; // longest main loop time spent on snapshots and blocking saves
+        kf::u32 max_stall_ms;    // longest main loop lateness while a commit was written (flash cache off)
+    };
+
+    /// @brief Commits wait while it returns true
+    using HoldCondition = bool (*)();
 
-    [[nodiscard]] Config &config() noexcept { return _storage.config; }
+    [[nodiscard]] constexpr const Config &config() const noexcept { return _config; }
+
+    [[nodiscard]] Config &config() noexcept { return _config; }
 
     [[nodiscard]] bool modified() const noexcept { return _modified; }
 
-    void modified(bool is_modified) noexcept { _modified = is_modified; }
+    /// @brief Mark RAM config changed and schedule a commit, or cancel the scheduled one
+    void modified(bool is_modified) noexcept {
+        if (not is_modified) {
+            _modified = false;
+            return;
+        }
+
+        const auto now = Clock::now();
+        if (not _modified) {
+            _modified = true;
+            _modified_since = now;
+        }
+
+        const auto quiet = now + commit_delay;
+        const auto latest = _modified_since + max_commit_delay;
+        _commit_at = quiet < latest ? quiet : latest;
+    }
+
+    [[nodiscard]] const CommitStats &commitStats() const noexcept { return _commit_stats; }
+
+    /// @brief Postpone background commits, even past max_commit_delay, while the condition holds
+    void holdCommits(HoldCondition condition) noexcept { _hold = condition; }
+
+    /// @brief Lateness of one main loop step, counted as a commit stall when a commit ran since the previous step
+    void loopLateness(kf::math::Milliseconds late) noexcept {
+        const auto started = _commit_task.started();
+        const bool overlapped = _commit_task.busy() or started != _commits_seen;
+        _commits_seen = started;
+
+        if (overlapped and late > _commit_stats.max_stall_ms) { _commit_stats.max_stall_ms = late; }
+    }
+
+    /// @brief Upgrade the parts of a pre-section config blob into config, sections it did not have are left as they are
+    /// @return Blob version has a known layout
+    static bool importLegacy(const internal::LegacyConfig &legacy, Config &config) noexcept {
+        if (legacy.version != internal::LegacyConfig::last_version) {
+            logger.error(kf::memory::ArrayString<48>::formatted("Legacy config version %d has no known layout", legacy.version).view());
+            return false;
+        }
+
+        struct Part {
+            const void *from;// null for sections the legacy blob did not have
+            void *to;
+            kf::usize size;
+        };
+
+        // In Section order
+        const kf::memory::Array<Part, sections_total> parts{{
+            {&legacy.periphery, &config.periphery, sizeof(config.periphery)},
+            {&legacy.input_handler, &config.input_handler, sizeof(config.input_handler)},
+            {&legacy.control, &config.control, sizeof(config.control)},
+            {&legacy.peer_favorites, &config.peer_favorites, sizeof(config.peer_favorites)},
+            {&legacy.device_name, &config.device_name, sizeof(config.device_name)},
+            {nullptr, &config.peer_profiles, sizeof(config.peer_profiles)},
+        }};
+
+        for (kf::u8 i = 0; i < sections_total; i += 1) {
+            const auto &part = parts[i];
+            if (part.from == nullptr) { continue; }
 
+            (void) memory::migrate(layouts[i], 1, static_cast<const kf::u8 *>(part.from), part.size, static_cast<kf::u8 *>(part.to));
+        }
+
+        return true;
+    }
+
+    /// @brief Nothing scheduled or being written: flash is quiet
+    [[nodiscard]] bool settled() const noexcept { return not _modified and not _commit_task.busy(); }
+
+    /// @brief Commit changed sections at the next poll, in the background
     void save() noexcept {
-        logger.info("Saving config to NVS");
+        modified(true);
+        _commit_at = Clock::now();
+    }
+
+    /// @brief Write changed sections in place, blocking
+    void saveNow() noexcept {
+        const auto start = micros();
+        finishCommit();
+
+        kf::u8 written{0};
 
-        if (not _storage.save()) {
-            logger.error("Failed to save config into NVS");
+        for (auto &section: _sections) {
+            if (not section.dirty()) { continue; }
+
+            if (_storage.save(section)) {
+                written += 1;
+            } else {
+                logger.error(kf::memory::ArrayString<48>::formatted("Failed to save section %s into NVS", section.key).view());
+            }
         }
+
+        logger.info(kf::memory::ArrayString<48>::formatted("Saved %d of %d config sections", written, sections_total).view());
+        modified(false);
+        recordSnapshot(static_cast<kf::u32>(micros() - start));
     }
 
     void load() noexcept {
         logger.info("Loading config from NVS");
+        finishCommit();
 
-        if (not _storage.load()) {
-            logger.error("Failed to load config");
-            reset();
-            save();
-        }
+        kf::u8 missing{0};
+
+        for (kf::u8 i = 0; i < sections_total; i += 1) {
+            auto &section = _sections[i];
+            const auto result = _storage.load(section);
+
+            if (result == memory::SectionedStorage::LoadResult::Ok) { continue; }
+            modified(true);
+
+            if (result == memory::SectionedStorage::LoadResult::Missing) { missing += 1; }
+
+            if (result == memory::SectionedStorage::LoadResult::Outdated and migrateSection(static_cast<Section>(i))) { continue; }
 
-        if (not _storage.config.isLatestVersion()) {
-            logger.error("Config version is outdated");
-            reset();
-            save();
+            logger.error(kf::memory::ArrayString<64>::formatted(
+                             "Section %s %s, using defaults",
+                             section.key,
+                             memory::SectionedStorage::stringFromLoadResult(result))
+                             .view());
+            resetSection(static_cast<Section>(i));
         }
+
+        if (missing == sections_total) { (void) importLegacy(); }
+
+        if (modified()) { saveNow(); }
     }
 
     void reset() noexcept {
         logger.info("Resetting RAM config cache to defaults");
 
-        _storage.config = djc::Config::defaults();
+        _config = djc::Config::defaults();
         modified(true);
     }
 
 private:
     static constexpr auto logger{kf::Logger::create("ConfigManager")};
 
-    kf::memory::Storage<Config> _storage{
-        .key = "DC",
-        .config = djc::Config::defaults(),
-    };
+    // Bump a section version when its layout changes
+    static constexpr kf::u16 periphery_version{1};
+    static constexpr kf::u16 input_handler_version{1};
+    static constexpr kf::u16 control_version{1};
+    static constexpr kf::u16 peer_favorites_version{1};
+    static constexpr kf::u16 identity_version{1};
+    static constexpr kf::u16 peer_profiles_version{1};
+
+    static_assert(sizeof(Periphery::Config) <= memory::SectionedStorage::max_section_size);
+    static_assert(sizeof(InputHandler::Config) <= memory::SectionedStorage::max_section_size);
+    static_assert(sizeof(Control::Config) <= memory::SectionedStorage::max_section_size);
+    static_assert(sizeof(Config::PeerFavoritesConfig) <= memory::SectionedStorage::max_section_size);
+    static_assert(sizeof(Control::Profiles) <= memory::SectionedStorage::max_section_size);
+
+    Config _config{djc::Config::defaults()};
+
+    memory::SectionedStorage _storage{"djc"};
+    memory::CommitTask _commit_task{_storage};
+    kf::memory::Array<kf::u8, sections_total> _committing{};// section of each queued write
+    CommitStats _commit_stats{};
+
+    // In Section order
+    kf::memory::Array<memory::StorageSection, sections_total> _sections{{
+        {"periphery", periphery_version, &_config.periphery, sizeof(_config.periphery), 0, 0, 0},
+        {"input", input_handler_version, &_config.input_handler, sizeof(_config.input_handler), 0, 0, 0},
+        {"control", control_version, &_config.control, sizeof(_config.control), 0, 0, 0},
+        {"favorites", peer_favorites_version, &_config.peer_favorites, sizeof(_config.peer_favorites), 0, 0, 0},
+        {"identity", identity_version, &_config.device_name, sizeof(_config.device_name), 0, 0, 0},
+        {"profiles", peer_profiles_version, &_config.peer_profiles, sizeof(_config.peer_profiles), 0, 0, 0},
+    }};
+
+    // Layout chains, in Section order
+    static constexpr kf::memory::Array<kf::memory::Slice<const memory::SectionLayout>, sections_total> layouts{{
+        {internal::periphery_layouts.data(), internal::periphery_layouts.size()},
+        {internal::input_handler_layouts.data(), internal::input_handler_layouts.size()},
+        {internal::control_layouts.data(), internal::control_layouts.size()},
+        {internal::peer_favorites_layouts.data(), internal::peer_favorites_layouts.size()},
+        {internal::identity_layouts.data(), internal::identity_layouts.size()},
+        {internal::peer_profiles_layouts.data(), internal::peer_profiles_layouts.size()},
+    }};
+
+    static_assert(internal::periphery_layouts[internal::periphery_layouts.size() - 1].version == periphery_version);
+    static_assert(internal::input_handler_layouts[internal::input_handler_layouts.size() - 1].version == input_handler_version);
+    static_assert(internal::control_layouts[internal::control_layouts.size() - 1].version == control_version);
+    static_assert(internal::peer_favorites_layouts[internal::peer_favorites_layouts.size() - 1].version == peer_favorites_version);
+    static_assert(internal::identity_layouts[internal::identity_layouts.size() - 1].version == identity_version);
+    static_assert(internal::peer_profiles_layouts[internal::peer_profiles_layouts.size() - 1].version == peer_profiles_version);
 
     bool _modified{false};
+    kf::math::Milliseconds _modified_since{0}, _commit_at{0};
+    HoldCondition _hold{nullptr};
+    kf::u32 _commits_seen{0};
+
+    void recordSnapshot(kf::u32 duration_us) noexcept {
+        if (duration_us > _commit_stats.max_snapshot_us) { _commit_stats.max_snapshot_us = duration_us; }
+    }
+
+    /// @brief Snapshot changed sections and hand them to the commit task
+    void startCommit() noexcept {
+        const auto start = micros();
+
+        kf::u8 queued{0};
+        for (kf::u8 i = 0; i < sections_total; i += 1) {
+            auto &section = _sections[i];
+            if (not section.dirty()) { continue; }
+
+            if (_commit_task.add(memory::SectionedStorage::prepare(section, static_cast<const kf::u8 *>(section.data)))) {
+                _committing[queued] = i;
+                queued += 1;
+            }
+        }
+
+        _modified = false;
+        if (queued > 0) { _commit_task.submit(); }
+
+        recordSnapshot(static_cast<kf::u32>(micros() - start));
+    }
+
+    /// @brief Account a finished commit
+    void takeCommitResult() noexcept {
+        const auto result = _commit_task.takeResult();
+        if (not result.hasValue()) { return; }
+
+        const auto &value = result.value();
+        for (kf::u8 i = 0; i < _commit_task.writesTotal(); i += 1) {
+            if (_commit_task.succeeded(i)) {
+                memory::SectionedStorage::committed(_sections[_committing[i]], _commit_task.write(i));
+            }
+        }
+
+        _commit_stats.commits += 1;
+        _commit_stats.sections_written += value.written;
+        _commit_stats.failures += value.failed;
+        _commit_stats.last_duration_us = value.duration_us;
+
+        logger.info(kf::memory::ArrayString<80>::formatted(
+                        "Committed %d sections in %lu us, max loop stall %lu ms",
+                        value.written,
+                        static_cast<unsigned long>(value.duration_us),
+                        static_cast<unsigned long>(_commit_stats.max_stall_ms))
+                        .view());
+
+        if (value.failed > 0) {
+            logger.error("Config commit failed, retrying");
+            modified(true);
+        }
+    }
+
+    /// @brief Wait for a running commit, so the next NVS access sees its slots
+    void finishCommit() noexcept {
+        while (_commit_task.busy()) { delay(1); }
+        takeCommitResult();
+    }
+
+    /// @brief Upgrade the outdated entry of the last load into RAM
+    bool migrateSection(Section section) noexcept {
+        const auto index = static_cast<kf::u8>(section);
+        const auto entry = _storage.lastEntry();
+
+        resetSection(section);
+        if (not memory::migrate(layouts[index], entry.version, entry.payload, entry.size, static_cast<kf::u8 *>(_sections[index].data))) {
+            return false;
+        }
+
+        logger.info(kf::memory::ArrayString<48>::formatted("Section %s migrated from version %d", _sections[index].key, entry.version).view());
+        return true;
+    }
+
+    /// @brief Take sections from the single-blob config of earlier firmware
+    bool importLegacy() noexcept {
+        kf::memory::Storage<internal::LegacyConfig> legacy{
+            .key = "DC",
+            .config = internal::LegacyConfig::defaults(),
+        };
+
+        if (not legacy.load()) { return false; }
+
+        if (not importLegacy(legacy.config, _config)) { return false; }
+
+        logger.info("Legacy config imported");
+        return true;
+    }
+
+    // impl
+
+    KF_IMPL_TIMED_POLLABLE(ConfigManager);
+    void pollImpl(kf::math::Milliseconds now) noexcept {
+        takeCommitResult();
+
+        if (not _modified or _commit_task.busy() or now < _commit_at) { return; }
+        if (_hold != nullptr and _hold()) { return; }
+
+        startCommit();
+    }
+
+    KF_IMPL_INITABLE(ConfigManager, bool);
+    bool initImpl() noexcept { return _commit_task.init(); }
+
+    void resetSection(Section section) noexcept {
+        switch (section) {
+            case Section::Periphery: _config.periphery = Periphery::Config::defaults(); return;
+            case Section::InputHandler: _config.input_handler = InputHandler::Config::defaults(); return;
+            case Section::Control: _config.control = Control::Config::defaults(); return;
+            case Section::PeerFavorites: _config.peer_favorites = Config::PeerFavoritesConfig::defaults(); return;
+            case Section::Identity: _config.device_name = Config::defaults().device_name; return;
+            case Section::PeerProfiles: _config.peer_profiles = Control::Profiles::defaults(); return;
+        }
+    }
 };
 
-}// namespace djc
\ No newline at end of file
+}// namespace djc
@@ -0,0 +1,154 @@
+// Copyright (c) 2026 KiraFlux
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#pragma once
+
+#include <cstddef>
+
+#include <kf/aliases.hpp>
+#include <kf/memory/Array.hpp>
+#include <kf/memory/Slice.hpp>
+
+#include "djc/Config.hpp"
+#include "djc/memory/Migration.hpp"
+
+/// Stored layouts of config sections, oldest first.
+/// To change a section layout: freeze its current layout below as literal offsets, append the new version
+/// (with a fixup if a kept field changes meaning) and bump the section version in ConfigManager.
+/// Never reuse a field id for a field with another meaning
+
+namespace djc::internal {
+
+// Field ids
+
+enum class PeripheryField : kf::u8 {
+    Button,
+    AxisFilter,
+    LeftJoystick,
+    RightJoystick,
+    Bus,
+    BusNode,
+    Display,
+    TuneSamples,
+    Tuned,
+};
+
+enum class InputHandlerField : kf::u8 {
+    DirectionListener,
+};
+
+enum class ControlField : kf::u8 {
+    HeartbeatPeriod,
+    PollPeriod,
+    ReceiveTimeout,
+    InitMode,
+};
+
+enum class PeerFavoritesField : kf::u8 {
+    Items,
+    ItemsSaved,
+    SelectedIndex,
+};
+
+enum class PeerProfilesField : kf::u8 {
+    Items,
+    ItemsSaved,
+};
+
+enum class IdentityField : kf::u8 {
+    DeviceName,
+};
+
+// Version 1: layouts of the first sectioned firmware
+
+static constexpr kf::memory::Array<memory::FieldLayout, 9> periphery_v1_fields{{
+    memory::field(PeripheryField::Button, offsetof(PeripheryConfig, button), sizeof(PeripheryConfig::button)),
+    memory::field(PeripheryField::AxisFilter, offsetof(PeripheryConfig, axis_filter), sizeof(PeripheryConfig::axis_filter)),
+    memory::field(PeripheryField::LeftJoystick, offsetof(PeripheryConfig, left_joystick), sizeof(PeripheryConfig::left_joystick)),
+    memory::field(PeripheryField::RightJoystick, offsetof(PeripheryConfig, right_joystick), sizeof(PeripheryConfig::right_joystick)),
+    memory::field(PeripheryField::Bus, offsetof(PeripheryConfig, bus), sizeof(PeripheryConfig::bus)),
+    memory::field(PeripheryField::BusNode, offsetof(PeripheryConfig, bus_node), sizeof(PeripheryConfig::bus_node)),
+    memory::field(PeripheryField::Display, offsetof(PeripheryConfig, display), sizeof(PeripheryConfig::display)),
+    memory::field(PeripheryField::TuneSamples, offsetof(PeripheryConfig, joystick_axes_tune_samples), sizeof(PeripheryConfig::joystick_axes_tune_samples)),
+    memory::field(PeripheryField::Tuned, offsetof(PeripheryConfig, joystick_axes_tuned), sizeof(PeripheryConfig::joystick_axes_tuned)),
+}};
+
+static constexpr kf::memory::Array<memory::FieldLayout, 1> input_handler_v1_fields{{
+    memory::field(InputHandlerField::DirectionListener, offsetof(InputHandler::Config, direction_listener), sizeof(InputHandler::Config::direction_listener)),
+}};
+
+static constexpr kf::memory::Array<memory::FieldLayout, 4> control_v1_fields{{
+    memory::field(ControlField::HeartbeatPeriod, offsetof(ControlConfig, heartbeat_period), sizeof(ControlConfig::heartbeat_period)),
+    memory::field(ControlField::PollPeriod, offsetof(ControlConfig, poll_period), sizeof(ControlConfig::poll_period)),
+    memory::field(ControlField::ReceiveTimeout, offsetof(ControlConfig, receive_timeout), sizeof(ControlConfig::receive_timeout)),
+    memory::field(ControlField::InitMode, offsetof(ControlConfig, init_mode), sizeof(ControlConfig::init_mode)),
+}};
+
+static constexpr kf::memory::Array<memory::FieldLayout, 3> peer_favorites_v1_fields{{
+    memory::field(PeerFavoritesField::Items, offsetof(Config::PeerFavoritesConfig, items), sizeof(Config::PeerFavoritesConfig::items)),
+    memory::field(PeerFavoritesField::ItemsSaved, offsetof(Config::PeerFavoritesConfig, items_saved), sizeof(Config::PeerFavoritesConfig::items_saved)),
+    memory::field(PeerFavoritesField::SelectedIndex, offsetof(Config::PeerFavoritesConfig, selected_index), sizeof(Config::PeerFavoritesConfig::selected_index)),
+}};
+
+static constexpr kf::memory::Array<memory::FieldLayout, 2> peer_profiles_v1_fields{{
+    memory::field(PeerProfilesField::Items, offsetof(PeerProfilesConfig, items), sizeof(PeerProfilesConfig::items)),
+    memory::field(PeerProfilesField::ItemsSaved, offsetof(PeerProfilesConfig, items_saved), sizeof(PeerProfilesConfig::items_saved)),
+}};
+
+static constexpr kf::memory::Array<memory::FieldLayout, 1> identity_v1_fields{{
+    memory::field(IdentityField::DeviceName, 0, sizeof(Config::device_name)),
+}};
+
+// Chains
+
+static constexpr kf::memory::Array<memory::SectionLayout, 1> periphery_layouts{{
+    {1, sizeof(PeripheryConfig), {periphery_v1_fields.data(), periphery_v1_fields.size()}, nullptr},
+}};
+
+static constexpr kf::memory::Array<memory::SectionLayout, 1> input_handler_layouts{{
+    {1, sizeof(InputHandler::Config), {input_handler_v1_fields.data(), input_handler_v1_fields.size()}, nullptr},
+}};
+
+static constexpr kf::memory::Array<memory::SectionLayout, 1> control_layouts{{
+    {1, sizeof(ControlConfig), {control_v1_fields.data(), control_v1_fields.size()}, nullptr},
+}};
+
+static constexpr kf::memory::Array<memory::SectionLayout, 1> peer_favorites_layouts{{
+    {1, sizeof(Config::PeerFavoritesConfig), {peer_favorites_v1_fields.data(), peer_favorites_v1_fields.size()}, nullptr},
+}};
+
+static constexpr kf::memory::Array<memory::SectionLayout, 1> peer_profiles_layouts{{
+    {1, sizeof(PeerProfilesConfig), {peer_profiles_v1_fields.data(), peer_profiles_v1_fields.size()}, nullptr},
+}};
+
+static constexpr kf::memory::Array<memory::SectionLayout, 1> identity_layouts{{
+    {1, sizeof(Config::device_name), {identity_v1_fields.data(), identity_v1_fields.size()}, nullptr},
+}};
+
+/// @brief Single-blob config of firmware before sections, stored under "DC"
+/// @note Its parts are the version 1 section layouts: once a section changes, use its frozen version 1 type here.
+/// Peer profiles came after it and are not part of it
+struct LegacyConfig {
+    static constexpr kf::u16 last_version{4};
+
+    kf::u16 version;
+
+    PeripheryConfig periphery;
+    InputHandler::Config input_handler;
+    ControlConfig control;
+    Config::PeerFavoritesConfig peer_favorites;
+    kf::memory::Array<char, 16> device_name;
+
+    static constexpr LegacyConfig defaults() noexcept {
+        return LegacyConfig{
+            .version = 0,
+            .periphery = PeripheryConfig::defaults(),
+            .input_handler = InputHandler::Config::defaults(),
+            .control = ControlConfig::defaults(),
+            .peer_favorites = Config::PeerFavoritesConfig::defaults(),
+            .device_name = {},
+        };
+    }
+};
+
+}// namespace djc::internal
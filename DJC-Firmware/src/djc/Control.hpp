@@ -3,11 +3,14 @@
 
 #pragma once
 
+#include <atomic>
+#include <cstring>
 #include <utility>
 
+#include <Arduino.h>// for FreeRTOS
 #include <MAVLink.h>
+#include <esp_wifi.h>
 
-#include <kf/Function.hpp>
 #include <kf/Logger.hpp>
 #include <kf/Option.hpp>
 #include <kf/aliases.hpp>
@@ -20,6 +23,16 @@
 #include <kf/mixin/NonCopyable.hpp>
 #include <kf/mixin/TimedPollable.hpp>
 
+#include "djc/Clock.hpp"
+#include "djc/diagnostics/LatencyTracer.hpp"
+#include "djc/diagnostics/OfflinePeer.hpp"
+#include "djc/diagnostics/SessionRecorder.hpp"
+#include "djc/diagnostics/VehicleSimulator.hpp"
+#include "djc/input/InputFrame.hpp"
+#include "djc/memory/Box.hpp"
+#include "djc/memory/InplaceFunction.hpp"
+#include "djc/memory/Ring.hpp"
+#include "djc/memory/TripleBuffer.hpp"
 #include "djc/prelude.hpp"
 
 namespace djc {
@@ -47,17 +60,70 @@ struct ControlConfig final : kf::mixin::NonCopyable {
     }
 };
 
+/// @brief Telemetry streams requested from the vehicle on connect
+enum class TelemetryStream : kf::u8 {
+    Attitude = 1 << 0,// ATTITUDE_QUATERNION
+    Imu = 1 << 1,     // SCALED_IMU
+};
+
+/// @brief Control settings of one vehicle
+struct ControlProfile {
+
+    /// @brief Output axis taken from an input axis
+    struct Axis {
+        kf::u8 source;// input axis: left x, left y, right x, right y
+        kf::i16 rate; // per mille of the source, negative inverts
+    };
+
+    static constexpr kf::u8 axes_total{4};
+
+    ControlMode mode;
+    kf::math::Milliseconds poll_period;
+    kf::memory::Array<Axis, axes_total> axes;
+    kf::u8 telemetry;// TelemetryStream mask
+    kf::math::Milliseconds telemetry_period;
+
+    [[nodiscard]] constexpr bool subscribed(TelemetryStream stream) const noexcept {
+        return (telemetry & static_cast<kf::u8>(stream)) != 0;
+    }
+
+    /// @brief Global settings: straight axes, no telemetry requests
+    static constexpr ControlProfile fromConfig(const ControlConfig &config, ControlMode mode) noexcept {
+        return ControlProfile{
+            .mode = mode,
+            .poll_period = config.poll_period,
+            .axes = {{{0, 1000}, {1, 1000}, {2, 1000}, {3, 1000}}},
+            .telemetry = 0,
+            .telemetry_period = 100,// ms
+        };
+    }
+};
+
+struct PeerProfile {
+    EspNow::Mac mac;
+    ControlProfile profile;
+};
+
+using PeerProfilesConfig = djc::memory::Box<PeerProfile, kf::u8, 8>;
+
 }// namespace internal
 
+/// @brief ESP-NOW link to the active vehicle
+/// @details Control runs on its own task (see main.cpp) while UI code runs on the other core. The UI side never touches
+/// link state: it posts requests, drained at the next poll, and reads state and telemetry snapshots published
+/// through triple buffers. Methods not marked as UI side belong to the control side
 struct Control final : kf::mixin::NonCopyable, kf::mixin::TimedPollable<Control>, kf::mixin::Configurable<internal::ControlConfig>, kf::mixin::Initable<Control, bool> {
     using Config = internal::ControlConfig;
     using Mode = internal::ControlMode;
+    using Profile = internal::ControlProfile;
+    using Profiles = internal::PeerProfilesConfig;
+    using TelemetryStream = internal::TelemetryStream;
 
     using LogString = kf::memory::ArrayString<64>;
 
-    using RawMessageCallback = kf::Function<void(kf::memory::Slice<const kf::u8>)>;
-    using MavLinkMessageCallback = kf::Function<void(mavlink_message_t *)>;
-    using ReceiveFromUnknownCallback = EspNow::ReceiveFromUnknownHandler;
+    // Stored in place: pages swap them on entry and exit without heap traffic
+    using RawMessageCallback = memory::InplaceFunction<void(kf::memory::Slice<const kf::u8>)>;
+    using ReceiveFromUnknownCallback = memory::InplaceFunction<void(const EspNow::Mac &, kf::memory::Slice<const kf::u8>)>;
 
     struct Input {
         using Unit = kf::i16;
@@ -67,17 +133,148 @@ struct Control final : kf::mixin::NonCopyable, kf::mixin::TimedPollable<Control>
         Unit left_x, left_y, right_x, right_y;
 
         static constexpr Unit fromReal(kf::f32 value) noexcept { return static_cast<Unit>(value * scale); }
+
+        /// @brief Axes rearranged and scaled by a profile
+        [[nodiscard]] constexpr Input mapped(const Profile &profile) const noexcept {
+            constexpr Unit Input::*fields[Profile::axes_total]{&Input::left_x, &Input::left_y, &Input::right_x, &Input::right_y};
+
+            Input result{};
+            for (kf::u8 i = 0; i < Profile::axes_total; i += 1) {
+                const auto &axis = profile.axes[i];
+                if (axis.source >= Profile::axes_total) { continue; }
+
+                const auto value = static_cast<kf::i32>(this->*fields[axis.source]) * axis.rate / 1000;
+                result.*fields[i] = static_cast<Unit>(value > scale ? scale : (value < -scale ? -scale : value));
+            }
+            return result;
+        }
+
+        static constexpr Input fromFrame(const input::InputFrame &frame) noexcept {
+            return Input{
+                .left_x = fromReal(frame.left_joystick.x),
+                .left_y = fromReal(frame.left_joystick.y),
+                .right_x = fromReal(frame.right_joystick.x),
+                .right_y = fromReal(frame.right_joystick.y),
+            };
+        }
+    };
+
+    /// @brief Link snapshot published after every poll
+    struct State {
+        bool enabled;
+        bool connected;
+        EspNow::Mac mac;// of the active peer
+        Mode mode;
+        Input input;     // as mapped by the profile
+        Profile profile;
+        bool suspended;  // radio stopped for light sleep
+        kf::u8 power_ack;// sequence of the last executed suspend or resume request
     };
 
+    /// @brief Latest decoded MAVLink telemetry
+    struct Telemetry {
+        kf::u32 attitude_updates;
+        kf::memory::Array<float, 4> quaternion;// w, x, y, z
+        kf::u32 imu_updates;
+        kf::memory::Array<kf::i16, 3> acceleration;// mG
+    };
+
+    /// @brief One SCALED_IMU reading, kept in arrival order for plotting
+    struct ImuSample {
+        kf::memory::Array<kf::i16, 3> acceleration;// mG
+    };
+
+    static constexpr kf::usize max_raw_request{250};// ESP-NOW payload
+    static constexpr kf::u16 imu_samples_size{64};  // ~1.2 s of a 50 Hz stream
+
     explicit Control(const Config &config) noexcept : kf::mixin::Configurable<Config>{config} {}
 
-    // properties
+    // UI side
+
+    /// @brief Newest link state, one reader
+    [[nodiscard]] const State &state() noexcept { return _state.read(); }
+
+    /// @brief Newest telemetry, one reader
+    [[nodiscard]] const Telemetry &telemetry() noexcept { return _telemetry.read(); }
+
+    /// @brief Keep every IMU reading for takeImuSample() while on, the telemetry snapshot only holds the newest
+    void sampleImu(bool is_on) noexcept {
+        if (is_on) {
+            ImuSample stale;
+            while (_imu_samples.pop(stale)) {}
+        }
+        _imu_sampling.store(is_on, std::memory_order_release);
+    }
+
+    /// @brief Oldest IMU reading not taken yet, one reader
+    bool takeImuSample(ImuSample &sample) noexcept { return _imu_samples.pop(sample); }
+
+    /// @brief IMU readings lost because the reader fell behind the stream
+    [[nodiscard]] kf::u32 imuSamplesDropped() const noexcept { return _imu_samples.dropped(); }
+
+    /// @brief Connect at the next poll, with the stored profile of the peer if any
+    void requestConnect(const EspNow::Mac &mac) noexcept {
+        Request request{Request::Kind::Connect};
+        request.mac = mac;
+        post(request);
+    }
 
-    void onReceiveFromUnknown(ReceiveFromUnknownCallback &&callback) noexcept { EspNow::instance().onReceiveFromUnknown(std::move(callback)); }
+    void requestDisconnect() noexcept { post(Request{Request::Kind::Disconnect}); }
 
-    void onRawMessage(RawMessageCallback &&callback) noexcept { _raw_message_callback = std::move(callback); }
+    void requestMode(Mode new_mode) noexcept {
+        Request request{Request::Kind::Mode};
+        request.mode = new_mode;
+        post(request);
+    }
+
+    void requestEnabled(bool is_enabled) noexcept {
+        Request request{Request::Kind::Enable};
+        request.enabled = is_enabled;
+        post(request);
+    }
 
-    void onMavlinkMessage(MavLinkMessageCallback &&callback) noexcept { _mavlink_message_callback = std::move(callback); }
+    /// @brief Stop the radio for light sleep, remembering the active peer
+    /// @param sequence Published as State::power_ack once executed
+    /// @return false if the request queue is full
+    bool requestSuspend(kf::u8 sequence) noexcept {
+        Request request{Request::Kind::Suspend};
+        request.sequence = sequence;
+        return post(request);
+    }
+
+    /// @brief Restart the radio and reconnect the peer active before suspend
+    /// @param sequence Published as State::power_ack once executed
+    /// @return false if the request queue is full
+    bool requestResume(kf::u8 sequence) noexcept {
+        Request request{Request::Kind::Resume};
+        request.sequence = sequence;
+        return post(request);
+    }
+
+    /// @return false if the message is too long or the request queue is full
+    bool requestSendRaw(kf::memory::Slice<const kf::u8> buffer) noexcept {
+        if (buffer.size() > max_raw_request) { return false; }
+
+        Request request{Request::Kind::SendRaw};
+        std::memcpy(request.payload.data(), buffer.data(), buffer.size());
+        request.size = static_cast<kf::u8>(buffer.size());
+        return post(request);
+    }
+
+    // properties
+
+    /// @note Callbacks run on the radio task: they are swapped under the same lock they are invoked with
+    void onReceiveFromUnknown(ReceiveFromUnknownCallback &&callback) noexcept {
+        lockCallbacks();
+        _receive_from_unknown_callback = std::move(callback);
+        unlockCallbacks();
+    }
+
+    void onRawMessage(RawMessageCallback &&callback) noexcept {
+        lockCallbacks();
+        _raw_message_callback = std::move(callback);
+        unlockCallbacks();
+    }
 
     [[nodiscard]] Mode mode() const noexcept { return _mode; }
 
@@ -87,7 +284,37 @@ struct Control final : kf::mixin::NonCopyable, kf::mixin::TimedPollable<Control>
 
     [[nodiscard]] const Input &input() const noexcept { return _input; }
 
-    void input(const Input &new_input) noexcept { _input = new_input; }
+    void input(const Input &new_input) noexcept {
+        _input = new_input;
+        DJC_LATENCY_MARK(ControlInput);
+    }
+
+    /// @brief Bind the RAM cache of per-peer profiles, looked up on connect
+    /// @note Only the control side touches the cache afterwards: the UI side changes it through requests
+    void profiles(Profiles &profiles) noexcept { _profiles = &profiles; }
+
+    /// @brief Profile in use since the last connect
+    [[nodiscard]] const Profile &profile() const noexcept { return _profile; }
+
+    /// @brief Stored profile of a peer, if any
+    [[nodiscard]] const Profile *findProfile(const EspNow::Mac &mac) const noexcept {
+        const auto *entry = findEntry(mac);
+        return entry == nullptr ? nullptr : &entry->profile;
+    }
+
+    /// @brief UI side: store the profile in use, with the current mode, for the active peer at the next poll
+    /// @return false if no peer is active or the request queue is full
+    bool rememberProfile() noexcept {
+        if (not state().connected) { return false; }
+        return post(Request{Request::Kind::RememberProfile});
+    }
+
+    /// @brief UI side: drop the stored profile of the active peer at the next poll
+    /// @return false if no peer is active or the request queue is full
+    bool forgetProfile() noexcept {
+        if (not state().connected) { return false; }
+        return post(Request{Request::Kind::ForgetProfile});
+    }
 
     [[nodiscard]] bool enabled() const noexcept { return _enabled; }
 
@@ -104,6 +331,12 @@ struct Control final : kf::mixin::NonCopyable, kf::mixin::TimedPollable<Control>
     }
 
     void connect(const EspNow::Mac &mac) noexcept {
+        Profile profile;
+        const auto stored = resolveProfile(mac, _mode, profile);
+        connect(mac, profile, stored);
+    }
+
+    void connect(const EspNow::Mac &mac, const Profile &profile, bool stored_profile) noexcept {
         if (connected()) {
             if (_active_peer.value().mac() == mac) {
                 logger.debug("Already connected to active peer");
@@ -113,10 +346,16 @@ struct Control final : kf::mixin::NonCopyable, kf::mixin::TimedPollable<Control>
             disconnect();
         }
 
+        // Settle every setting before the peer becomes active: the first frame goes out with them
+        applyProfile(profile);
+        if (stored_profile) {
+            logger.info(LogString::formatted("Profile of '%s' applied", EspNow::stringFromMac(mac).data()).view());
+        }
+
         _active_peer = addPeer(mac);
         if (not connected()) { return; }
 
-        const auto receive_setup_result = _active_peer.value().onReceive([this](kf::memory::Slice<const kf::u8> buffer) { onReceive(buffer); });
+        const auto receive_setup_result = _active_peer.value().onReceive([this](kf::memory::Slice<const kf::u8> buffer) { receive(buffer); });
         if (receive_setup_result.isError()) {
             logger.error("Receive callback attachment failed");
             return;
@@ -152,18 +391,73 @@ struct Control final : kf::mixin::NonCopyable, kf::mixin::TimedPollable<Control>
 
     void sendRawMessage(kf::memory::Slice<const kf::u8> buffer) noexcept {
         if (connected()) {
+            DJC_SESSION_RECORD_CALL(sent, buffer);
+            DJC_VEHICLE_SIM_CALL(onControllerPacket, buffer);
             (void) _active_peer.value().writeBuffer(buffer);
         }
     }
 
+    // radio entry points (also used to feed recorded traffic back on replay)
+
+    void receive(kf::memory::Slice<const kf::u8> buffer) noexcept {
+        DJC_SESSION_RECORD_CALL(received, buffer);
+        onReceive(buffer);
+    }
+
+    void receiveFromUnknown(const EspNow::Mac &mac, kf::memory::Slice<const kf::u8> buffer) noexcept {
+        DJC_SESSION_RECORD_CALL(receivedFromUnknown, mac, buffer);
+
+        lockCallbacks();
+        if (_receive_from_unknown_callback) { _receive_from_unknown_callback(mac, buffer); }
+        unlockCallbacks();
+    }
+
 private:
     static constexpr auto logger{kf::Logger::create("Control")};
 
+#if defined(DJC_OFFLINE_RADIO)
+    using Peer = diagnostics::OfflinePeer;
+#else
+    using Peer = EspNow::Peer;
+#endif
+
+    /// @brief UI side call carried over to the control side
+    struct Request {
+        enum class Kind : kf::u8 {
+            Connect,
+            Disconnect,
+            Mode,
+            Enable,
+            SendRaw,
+            Suspend,
+            Resume,
+            RememberProfile,
+            ForgetProfile,
+        };
+
+        Kind kind;
+        EspNow::Mac mac{};
+        Mode mode{Mode::Raw};
+        bool enabled{false};
+        kf::u8 sequence{0};
+        kf::memory::Array<kf::u8, max_raw_request> payload{};
+        kf::u8 size{0};
+    };
+
     RawMessageCallback _raw_message_callback{};
-    MavLinkMessageCallback _mavlink_message_callback{};
+    ReceiveFromUnknownCallback _receive_from_unknown_callback{};
+    StaticSemaphore_t _callbacks_lock_buffer{};
+    SemaphoreHandle_t _callbacks_lock{xSemaphoreCreateMutexStatic(&_callbacks_lock_buffer)};// a mutex: callbacks may log
+
+    memory::Ring<Request, 4> _requests{};
+    memory::TripleBuffer<State> _state{};
+    memory::TripleBuffer<Telemetry> _telemetry{};
+    Telemetry _telemetry_latest{};// receive context only
+    memory::Ring<ImuSample, imu_samples_size> _imu_samples{};
+    std::atomic<bool> _imu_sampling{false};
 
-    kf::Option<EspNow::Peer> _active_peer{};
-    kf::Option<EspNow::Peer> _broadcast_peer{};
+    kf::Option<Peer> _active_peer{};
+    kf::Option<Peer> _broadcast_peer{};
 
     kf::math::Timer _poll_timer{this->config().poll_period};
     kf::math::Timer _heartbear_timer{this->config().heartbeat_period};
@@ -171,10 +465,172 @@ private:
 
     Input _input{};
     Mode _mode{this->config().init_mode};
+    Profiles *_profiles{nullptr};
+    Profile _profile{Profile::fromConfig(this->config(), this->config().init_mode)};
+    bool _telemetry_requested{false};
     bool _enabled{false};
+    bool _suspended{false};
+    kf::u8 _power_ack{0};
+    kf::Option<EspNow::Mac> _resume_mac{};
+    Profile _resume_profile{};
     volatile bool _got_packet{false};
 
-    static kf::Option<EspNow::Peer> addPeer(const EspNow::Mac &mac) noexcept {
+    void lockCallbacks() noexcept { (void) xSemaphoreTake(_callbacks_lock, portMAX_DELAY); }
+
+    void unlockCallbacks() noexcept { (void) xSemaphoreGive(_callbacks_lock); }
+
+    [[nodiscard]] internal::PeerProfile *findEntry(const EspNow::Mac &mac) const noexcept {
+        if (_profiles == nullptr) { return nullptr; }
+
+        return _profiles->findIf([&mac](const internal::PeerProfile &entry) { return entry.mac == mac; });
+    }
+
+    /// @brief Peer profile from the RAM cache, or global settings with the given mode
+    /// @return Profile was stored for the peer
+    bool resolveProfile(const EspNow::Mac &mac, Mode mode, Profile &profile) const noexcept {
+        const auto *stored = findProfile(mac);
+        profile = stored == nullptr ? Profile::fromConfig(this->config(), mode) : *stored;
+        return stored != nullptr;
+    }
+
+    void applyProfile(const Profile &profile) noexcept {
+        _profile = profile;
+        _mode = _profile.mode;
+        _poll_timer = kf::math::Timer{_profile.poll_period};
+        _poll_timer.start(Clock::now());
+        _telemetry_requested = _profile.telemetry == 0;
+    }
+
+    bool post(const Request &request) noexcept {
+        if (_requests.push(request)) { return true; }
+
+        logger.error("Request queue full, request dropped");
+        return false;
+    }
+
+    void executeRequests() noexcept {
+        Request request{Request::Kind::Disconnect};
+
+        while (_requests.pop(request)) {
+            switch (request.kind) {
+                case Request::Kind::Connect:
+                    connect(request.mac);
+                    break;
+
+                case Request::Kind::Disconnect:
+                    if (connected()) { disconnect(); }
+                    break;
+
+                case Request::Kind::Mode:
+                    mode(request.mode);
+                    break;
+
+                case Request::Kind::Enable:
+                    enabled(request.enabled);
+                    break;
+
+                case Request::Kind::SendRaw:
+                    sendRawMessage({request.payload.data(), request.size});
+                    break;
+
+                case Request::Kind::Suspend:
+                    suspend();
+                    _power_ack = request.sequence;
+                    break;
+
+                case Request::Kind::Resume:
+                    resume();
+                    _power_ack = request.sequence;
+                    break;
+
+                case Request::Kind::RememberProfile:
+                    storeProfile();
+                    break;
+
+                case Request::Kind::ForgetProfile:
+                    dropProfile();
+                    break;
+            }
+        }
+    }
+
+    void storeProfile() noexcept {
+        if (not connected() or _profiles == nullptr) { return; }
+
+        const auto mac = _active_peer.value().mac();
+        auto profile = _profile;
+        profile.mode = _mode;
+
+        if (auto *entry = findEntry(mac)) {
+            entry->profile = profile;
+            return;
+        }
+
+        if (not _profiles->add({mac, profile})) { logger.error("No room left for the peer profile"); }
+    }
+
+    void dropProfile() noexcept {
+        if (not connected()) { return; }
+
+        const auto *entry = findEntry(_active_peer.value().mac());
+        if (entry != nullptr) { (void) _profiles->remove(entry); }
+    }
+
+    /// @brief Light sleep does not keep Wi-Fi: drop the peer and stop the radio, ESP-NOW itself stays initialized
+    void suspend() noexcept {
+        if (_suspended) { return; }
+
+        _resume_mac = {};
+        if (connected()) {
+            _resume_mac = {_active_peer.value().mac()};
+            _resume_profile = _profile;
+            _resume_profile.mode = _mode;
+            disconnect();
+        }
+
+#if not defined(DJC_OFFLINE_RADIO)
+        if (esp_wifi_stop() != ESP_OK) { logger.error("Wi-Fi stop failed"); }
+#endif
+
+        _suspended = true;
+        logger.info("Suspended");
+    }
+
+    void resume() noexcept {
+        if (not _suspended) { return; }
+
+#if not defined(DJC_OFFLINE_RADIO)
+        if (esp_wifi_start() != ESP_OK) { logger.error("Wi-Fi start failed"); }
+#endif
+
+        _suspended = false;
+
+        if (_resume_mac.hasValue()) {
+            connect(_resume_mac.value(), _resume_profile, false);
+            _resume_mac = {};
+        }
+
+        logger.info("Resumed");
+    }
+
+    void publishState() noexcept {
+        _state.write(State{
+            .enabled = _enabled,
+            .connected = connected(),
+            .mac = connected() ? _active_peer.value().mac() : EspNow::Mac{},
+            .mode = _mode,
+            .input = _input.mapped(_profile),
+            .profile = _profile,
+            .suspended = _suspended,
+            .power_ack = _power_ack,
+        });
+    }
+
+    static kf::Option<Peer> addPeer(const EspNow::Mac &mac) noexcept {
+#if defined(DJC_OFFLINE_RADIO)
+        logger.info(LogString::formatted("Peer '%s' added (offline)", EspNow::stringFromMac(mac).data()).view());
+        return {Peer{mac}};
+#else
         auto peer_result = EspNow::Peer::add(mac);
         if (peer_result.isError()) {
             logger.error(
@@ -188,9 +644,13 @@ private:
 
         logger.info(LogString::formatted("Peer '%s' added", EspNow::stringFromMac(mac).data()).view());
         return {std::move(peer_result.value())};
+#endif
     }
 
-    static void delPeer(EspNow::Peer &peer) noexcept {
+    static void delPeer(Peer &peer) noexcept {
+#if defined(DJC_OFFLINE_RADIO)
+        (void) peer;
+#else
         const auto result = peer.del();
         if (result.isError()) {
             logger.error(
@@ -201,6 +661,7 @@ private:
                     .view());
             return;
         }
+#endif
     }
 
     void onReceive(kf::memory::Slice<const kf::u8> buffer) noexcept {
@@ -217,50 +678,129 @@ private:
     }
 
     void onReceiveRaw(kf::memory::Slice<const kf::u8> buffer) noexcept {
+        lockCallbacks();
         if (_raw_message_callback) { _raw_message_callback(buffer); }
+        unlockCallbacks();
     }
 
     void onReceiveMavLink(kf::memory::Slice<const kf::u8> buffer) noexcept {
-        if (not _mavlink_message_callback) { return; }
-
         mavlink_message_t message;
         mavlink_status_t status;
+        bool updated{false};
 
         for (auto b: buffer) {
             if (mavlink_parse_char(MAVLINK_COMM_0, b, &message, &status) != 0) {
-                _mavlink_message_callback(&message);
+                updated |= decodeTelemetry(message);
             }
         }
+
+        if (updated) { _telemetry.write(_telemetry_latest); }
     }
 
-    void pollRaw(EspNow::Peer &peer, kf::math::Milliseconds) noexcept {
-        (void) peer.writePacket(_input);
+    /// @return Telemetry snapshot changed
+    bool decodeTelemetry(const mavlink_message_t &message) noexcept {
+        switch (message.msgid) {
+            case MAVLINK_MSG_ID_ATTITUDE_QUATERNION: {
+                mavlink_attitude_quaternion_t attitude;
+                mavlink_msg_attitude_quaternion_decode(&message, &attitude);
+
+                _telemetry_latest.quaternion = {attitude.q1, attitude.q2, attitude.q3, attitude.q4};
+                _telemetry_latest.attitude_updates += 1;
+                return true;
+            }
+
+            case MAVLINK_MSG_ID_SCALED_IMU: {
+                mavlink_scaled_imu_t imu;
+                mavlink_msg_scaled_imu_decode(&message, &imu);
+
+                _telemetry_latest.acceleration = {imu.xacc, imu.yacc, imu.zacc};
+                _telemetry_latest.imu_updates += 1;
+
+                if (_imu_sampling.load(std::memory_order_acquire)) { (void) _imu_samples.push({_telemetry_latest.acceleration}); }
+                return true;
+            }
+
+            case MAVLINK_MSG_ID_SERIAL_CONTROL: {
+                mavlink_serial_control_t serial_control;
+                mavlink_msg_serial_control_decode(&message, &serial_control);
+
+                const auto count = serial_control.count < sizeof(serial_control.data) ? serial_control.count : sizeof(serial_control.data);
+                logger.info({reinterpret_cast<const char *>(serial_control.data), static_cast<kf::usize>(count)});
+                return false;
+            }
+
+            default:
+                // Unhandled message type
+                return false;
+        }
     }
 
-    void pollMavLink(EspNow::Peer &peer, kf::math::Milliseconds now) noexcept {
+    void pollRaw(Peer &peer, kf::math::Milliseconds) noexcept {
+        DJC_LATENCY_MARK(Encode);// raw packet is sent as is
+        const auto output = _input.mapped(_profile);
+        DJC_SESSION_RECORD_CALL(sent, {reinterpret_cast<const kf::u8 *>(&output), sizeof(output)});
+        (void) peer.writePacket(output);
+        DJC_LATENCY_MARK(Send);
+    }
+
+    void pollMavLink(Peer &peer, kf::math::Milliseconds now) noexcept {
         sendMavLinkControl(peer);
 
+        if (not _telemetry_requested) {
+            _telemetry_requested = true;
+            requestTelemetry(peer);
+        }
+
         if (_heartbear_timer.expired(now)) {
             _heartbear_timer.start(now);
             sendMavLinkHeartbeat(peer);
         }
     }
 
-    void sendMavLinkControl(EspNow::Peer &peer) noexcept {
+    void sendMavLinkControl(Peer &peer) noexcept {
+        const auto output = _input.mapped(_profile);
+
         mavlink_message_t message;
         (void) mavlink_msg_manual_control_pack(
             127, MAV_COMP_ID_PARACHUTE, &message, 1,
-            _input.right_y,// x: pitch (right Y)
-            _input.right_x,// y: roll (right X)
-            _input.left_y, // z: thrust (left Y)
-            _input.left_x, // r: yaw (left X)
+            output.right_y,// x: pitch (right Y)
+            output.right_x,// y: roll (right X)
+            output.left_y, // z: thrust (left Y)
+            output.left_x, // r: yaw (left X)
             // Buttons (unused)
             0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0);
 
         sendMavLinkMessage(peer, &message);
     }
 
-    void sendMavLinkHeartbeat(EspNow::Peer &peer) noexcept {
+    /// @brief Ask the vehicle for the subscribed streams at the profile period
+    void requestTelemetry(Peer &peer) noexcept {
+        constexpr struct {
+            TelemetryStream stream;
+            kf::u32 message_id;
+        } streams[]{
+            {TelemetryStream::Attitude, MAVLINK_MSG_ID_ATTITUDE_QUATERNION},
+            {TelemetryStream::Imu, MAVLINK_MSG_ID_SCALED_IMU},
+        };
+
+        const auto interval_us = static_cast<float>(_profile.telemetry_period) * 1000.0f;
+
+        for (const auto &entry: streams) {
+            if (not _profile.subscribed(entry.stream)) { continue; }
+
+            mavlink_message_t message;
+            (void) mavlink_msg_command_long_pack(
+                127, MAV_COMP_ID_OSD, &message,
+                1, 0,// target system, component
+                MAV_CMD_SET_MESSAGE_INTERVAL, 0,
+                static_cast<float>(entry.message_id), interval_us,
+                0, 0, 0, 0, 0);
+
+            sendMavLinkMessage(peer, &message);
+        }
+    }
+
+    void sendMavLinkHeartbeat(Peer &peer) noexcept {
         mavlink_message_t message;
         (void) mavlink_msg_heartbeat_pack(
             127,            // System ID
@@ -274,10 +814,17 @@ private:
         sendMavLinkMessage(peer, &message);
     }
 
-    void sendMavLinkMessage(EspNow::Peer &peer, mavlink_message_t *message) noexcept {
+    void sendMavLinkMessage(Peer &peer, mavlink_message_t *message) noexcept {
         kf::u8 buffer[MAVLINK_MAX_PACKET_LEN];
         const auto len = mavlink_msg_to_send_buffer(buffer, message);
-        (void) peer.writeBuffer(kf::memory::Slice<const kf::u8>{buffer, len});
+        DJC_LATENCY_MARK(Encode);
+
+        const kf::memory::Slice<const kf::u8> packet{buffer, len};
+        DJC_SESSION_RECORD_CALL(sent, packet);
+        DJC_VEHICLE_SIM_CALL(onControllerPacket, packet);
+
+        (void) peer.writeBuffer(packet);
+        DJC_LATENCY_MARK(Send);
     }
 
     // impl
@@ -286,17 +833,23 @@ private:
     bool initImpl() noexcept {
         logger.info("init");
 
+#if defined(DJC_OFFLINE_RADIO)
+        logger.info("radio off: peers are offline stand-ins");
+#else
         const auto result = EspNow::instance().init();
         if (result.isError()) {
             logger.error(LogString::formatted("Failed to initialize ESP-NOW: %s", EspNow::stringFromError(result.error())));
             return false;
         }
 
+        EspNow::instance().onReceiveFromUnknown([this](const EspNow::Mac &mac, kf::memory::Slice<const kf::u8> buffer) { receiveFromUnknown(mac, buffer); });
+#endif
+
         _broadcast_peer = addPeer(EspNow::Mac{0xff, 0xff, 0xff, 0xff, 0xff, 0xff});
 
         _mode = this->config().init_mode;
 
-        const auto now = millis();
+        const auto now = Clock::now();
         _poll_timer.start(now);
         _heartbear_timer.start(now);
 
@@ -307,6 +860,12 @@ private:
 
     KF_IMPL_TIMED_POLLABLE(Control);
     void pollImpl(kf::math::Milliseconds now) noexcept {
+        executeRequests();
+        pollPeer(now);
+        publishState();
+    }
+
+    void pollPeer(kf::math::Milliseconds now) noexcept {
         if (not connected()) { return; }
 
         if (_got_packet) {
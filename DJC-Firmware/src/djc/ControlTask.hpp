@@ -0,0 +1,125 @@
+// Copyright (c) 2026 KiraFlux
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#pragma once
+
+#include <atomic>
+#include <utility>
+
+#include <Arduino.h>// for micros, FreeRTOS
+
+#include <kf/Logger.hpp>
+#include <kf/aliases.hpp>
+#include <kf/math/units.hpp>
+#include <kf/memory/ArrayString.hpp>
+#include <kf/mixin/Initable.hpp>
+#include <kf/mixin/NonCopyable.hpp>
+
+#include "djc/Clock.hpp"
+#include "djc/diagnostics/AllocationTracer.hpp"
+#include "djc/memory/InplaceFunction.hpp"
+
+namespace djc {
+
+/// @brief Runs the input-to-air path at a fixed period from a high priority task on the radio core
+/// @details The main loop (UI, display, storage) keeps core 1 to itself, so a heavy frame never delays a control tick
+struct ControlTask final : kf::mixin::NonCopyable, kf::mixin::Initable<ControlTask, bool> {
+    using Tick = memory::InplaceFunction<void(kf::math::Milliseconds)>;
+
+    explicit ControlTask(kf::math::Milliseconds period, Tick &&tick) noexcept :
+        _period{period}, _tick{std::move(tick)} {}
+
+    [[nodiscard]] bool running() const noexcept { return _task != nullptr; }
+
+    /// @brief Change the tick period (power saving), applied from the next tick
+    void period(kf::math::Milliseconds new_period) noexcept {
+        if (new_period > 0) { _period.store(new_period, std::memory_order_relaxed); }
+    }
+
+    [[nodiscard]] kf::math::Milliseconds period() const noexcept { return _period.load(std::memory_order_relaxed); }
+
+    /// @brief Write tick timing to the log (serial)
+    void report() const noexcept {
+        logger.info(
+            kf::memory::ArrayString<96>::formatted(
+                "ticks %lu overruns %lu | run max %lu us | period jitter max %lu us",
+                static_cast<unsigned long>(_ticks.load(std::memory_order_relaxed)),
+                static_cast<unsigned long>(_overruns.load(std::memory_order_relaxed)),
+                static_cast<unsigned long>(_max_run_us.load(std::memory_order_relaxed)),
+                static_cast<unsigned long>(_max_jitter_us.load(std::memory_order_relaxed)))
+                .view());
+    }
+
+private:
+    static constexpr auto logger{kf::Logger::create("ControlTask")};
+
+    static constexpr kf::u32 stack_size{4096};
+    static constexpr UBaseType_t priority{5};// above display flush and config commit
+    static constexpr BaseType_t core{0};     // radio core, main loop runs on core 1
+
+    std::atomic<kf::math::Milliseconds> _period;
+    Tick _tick;
+    TaskHandle_t _task{nullptr};
+
+    // Written by the task only
+    std::atomic<kf::u32> _ticks{0}, _overruns{0}, _max_run_us{0}, _max_jitter_us{0};
+
+    static void raise(std::atomic<kf::u32> &maximum, kf::u32 value) noexcept {
+        if (value > maximum.load(std::memory_order_relaxed)) { maximum.store(value, std::memory_order_relaxed); }
+    }
+
+    [[noreturn]] void run() noexcept {
+#if defined(DJC_ALLOC_TRACE)
+        diagnostics::AllocationTracer::instance().watch();
+#endif
+
+        TickType_t wake = xTaskGetTickCount();
+        kf::u32 previous_start{0};
+        kf::math::Milliseconds previous_period{0};
+
+        while (true) {
+            const auto period = _period.load(std::memory_order_relaxed);
+            const auto period_ticks = pdMS_TO_TICKS(period) > 0 ? pdMS_TO_TICKS(period) : 1;
+            const auto period_us = period * 1000;
+
+            // Behind by a whole period (light sleep, period change): skip the missed ticks instead of bursting
+            const bool in_time = xTaskDelayUntil(&wake, period_ticks) == pdTRUE;
+            if (not in_time) { wake = xTaskGetTickCount(); }
+
+            const auto start = static_cast<kf::u32>(micros());
+            _tick(Clock::now());
+            const auto run_us = static_cast<kf::u32>(micros()) - start;
+
+            const auto ticks = _ticks.load(std::memory_order_relaxed);
+            if (ticks > 0 and in_time and period == previous_period) {
+                const auto interval = start - previous_start;
+                raise(_max_jitter_us, interval > period_us ? interval - period_us : period_us - interval);
+            }
+            previous_start = start;
+            previous_period = period;
+
+            raise(_max_run_us, run_us);
+            if (run_us > period_us) { _overruns.fetch_add(1, std::memory_order_relaxed); }
+            _ticks.store(ticks + 1, std::memory_order_relaxed);
+        }
+    }
+
+    [[noreturn]] static void taskEntry(void *self) noexcept { static_cast<ControlTask *>(self)->run(); }
+
+    // impl
+
+    KF_IMPL_INITABLE(ControlTask, bool);
+    bool initImpl() noexcept {
+        const auto created = xTaskCreatePinnedToCore(taskEntry, "djc-control", stack_size, this, priority, &_task, core);
+
+        if (created != pdPASS) {
+            _task = nullptr;
+            logger.error("task not created, control runs in the main loop");
+            return false;
+        }
+
+        return true;
+    }
+};
+
+}// namespace djc
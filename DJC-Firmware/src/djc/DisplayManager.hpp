@@ -3,130 +3,872 @@
 
 #pragma once
 
+#include <cstring>
+
+#include <Arduino.h>// for ESP.getFreeHeap
+
+#include <kf/Logger.hpp>
+#include <kf/Option.hpp>
+#include <kf/aliases.hpp>
 #include <kf/gfx/Canvas.hpp>
 #include <kf/gfx/Palette.hpp>
 #include <kf/image/DynamicImage.hpp>
+#include <kf/image/StaticImage.hpp>
 #include <kf/math/units.hpp>
 #include <kf/memory/ArrayString.hpp>
 #include <kf/mixin/Initable.hpp>
 #include <kf/mixin/NonCopyable.hpp>
+#include <kf/mixin/TimedPollable.hpp>
 
+#include "djc/Clock.hpp"
 #include "djc/Control.hpp"
+#include "djc/diagnostics/Cycles.hpp"
+#include "djc/diagnostics/FrameCapture.hpp"
+#include "djc/diagnostics/Histogram.hpp"
+#include "djc/display/GlyphCache.hpp"
+#include "djc/display/Painter.hpp"
+#include "djc/display/Window.hpp"
+#include "djc/display/WindowTransport.hpp"
 #include "djc/input/VirtualKeyboard.hpp"
 #include "djc/prelude.hpp"
+#include "djc/ui/FramePacer.hpp"
+#include "djc/ui/Graphic.hpp"
 #include "djc/ui/UI.hpp"
 
+#if defined(DJC_DISPLAY_STRIPS)
+#include <kf/memory/Array.hpp>
+#else
+#include "djc/display/DirtyTracker.hpp"
+#include "djc/display/FlushTask.hpp"
+#endif
+
 namespace djc {
 
-struct DisplayManager final : kf::mixin::NonCopyable, kf::mixin::Initable<DisplayManager, void> {
+/// @brief Renders UI frames and pushes them to the display
+/// @details By default frames are drawn into the driver framebuffer and changed windows are sent by DMA from a background
+/// task: the main loop keeps running during the transfer, the next frame is drawn once it is done.
+/// With DJC_DISPLAY_STRIPS frames are drawn and sent strip by strip through a small buffer instead: the driver and
+/// its framebuffer are not built, the transport initializes the panel. Init logs the RAM footprint of either build
+struct DisplayManager final : kf::mixin::NonCopyable, kf::mixin::TimedPollable<DisplayManager>, kf::mixin::Initable<DisplayManager, void> {
+
+    using FrameTimeHistogram = diagnostics::Histogram<16>;// microseconds
+    using GlyphCache = display::GlyphCache<DisplayDriver::PixelImpl>;
+
+    /// @brief SPI traffic and timing of frame flushes
+    struct FlushStats {
+        kf::u64 total_bytes;
+        kf::u32 frames, last_frame_bytes, full_frame_bytes;
+        kf::u32 deferred;// renders postponed while previous frame was transmitting
+        kf::u32 last_render_us;
+        kf::u8 last_windows;
+        FrameTimeHistogram render_time, flush_time;
+
+        [[nodiscard]] kf::u32 averageBytes() const noexcept { return frames == 0 ? 0 : static_cast<kf::u32>(total_bytes / frames); }
+    };
+
+    /// @brief Full-screen text render time
+    struct TextBenchmark {
+        kf::u32 canvas_us;// Canvas::text
+        kf::u32 cached_us;// glyph cache, warm
+    };
+
+    /// @brief Panel power state
+    enum class Power : kf::u8 {
+        On,
+        Dimmed,// ST7735 idle mode
+        Off,   // sleep in, frames are not rendered
+    };
 
-    explicit DisplayManager(DisplayDriver &display, const Control &control) noexcept :
-        _display{display}, _control{control} {}
+#if defined(DJC_DISPLAY_STRIPS)
+    explicit DisplayManager(display::WindowTransport &transport, const Control &control, const GlyphCache::Config &glyph_cache_config) noexcept :
+        _control{control}, _transport{transport}, _glyph_cache{glyph_cache_config} {}
+#else
+    explicit DisplayManager(DisplayDriver &display, display::WindowTransport &transport, const Control &control, const GlyphCache::Config &glyph_cache_config) noexcept :
+        _display{display}, _control{control}, _transport{transport}, _glyph_cache{glyph_cache_config}, _flush_task{transport} {}
+#endif
+
+    /// @brief Change panel power once no frame is on the wire
+    void power(Power new_power) noexcept { _power_target = new_power; }
+
+    [[nodiscard]] Power power() const noexcept { return _power; }
+
+    [[nodiscard]] const FlushStats &flushStats() const noexcept { return _flush_stats; }
+
+    [[nodiscard]] const GlyphCache::Stats &glyphCacheStats() const noexcept { return _glyph_cache.stats(); }
+
+    /// @brief Render a screen (strip) of text with and without the glyph cache
+    /// @note Draws over the framebuffer, a redraw is requested afterwards
+    TextBenchmark benchmarkText() noexcept {
+#if defined(DJC_DISPLAY_STRIPS)
+        _clip_top = 0;
+        _clip_bottom = _strip_rows;
+#else
+        // Benchmark pixels may reach the panel through a transfer in flight: the redraw resends the whole frame
+        _dirty_tracker.invalidate();
+#endif
+        const auto rows = static_cast<kf::usize>((_clip_bottom - _clip_top) / _canvas.glyphHeight());
+        const auto columns = static_cast<kf::usize>(_screen_width / _canvas.glyphWidth());
+
+        char screen_text[24 * 33 + 1];
+        kf::usize length{0};
+
+        for (kf::usize row = 0; row < rows and row < 24; row += 1) {
+            for (kf::usize column = 0; column < columns and column < 32; column += 1) {
+                screen_text[length++] = static_cast<char>('!' + (row * columns + column) % 94);
+            }
+            screen_text[length++] = '\n';
+        }
+        screen_text[length] = '\0';
+
+        background(P::black);
+        foreground(P::white);
+
+        auto start = diagnostics::cycles();
+        _canvas.fill();
+        _canvas.text(0, 0, screen_text);
+        const auto canvas_us = (diagnostics::cycles() - start) / diagnostics::cyclesPerMicrosecond();
+
+        _canvas.fill();
+        text(0, 0, {screen_text, length});// warm up
+
+        start = diagnostics::cycles();
+        _canvas.fill();
+        text(0, 0, {screen_text, length});
+        const auto cached_us = (diagnostics::cycles() - start) / diagnostics::cyclesPerMicrosecond();
+
+        _keyboard_view.valid = false;
+        _graphic_valid = false;
+        frame_pacer.request();
+
+        return TextBenchmark{.canvas_us = canvas_us, .cached_us = cached_us};
+    }
 
 private:
     using P = kf::gfx::Palette<DisplayDriver::PixelImpl>;
+    using GlyphKey = GlyphCache::Key;
+
+    static constexpr auto logger{kf::Logger::create("DisplayManager")};
+
+    /// @brief Keyboard state shown in the framebuffer
+    struct KeyboardView {
+        kf::usize available;
+        kf::i8 row, col;
+        bool shifted;
+        bool valid;
+    };
+
+    /// @brief Completed frame
+    struct FrameResult {
+        kf::u32 bytes;
+        kf::u32 duration_us;// transfer time, 0 when not measured separately
+        kf::u8 windows;
+    };
 
     inline static const auto &virtual_keyboard = input::VirtualKeyboard::instance();
+    inline static const auto &graphic_view = ui::GraphicView::instance();
+    inline static auto &frame_pacer = ui::FramePacer::instance();
+#if defined(DJC_FRAME_CAPTURE)
+    inline static auto &frame_capture = diagnostics::FrameCapture::instance();
+#endif
 
+#if not defined(DJC_DISPLAY_STRIPS)
     DisplayDriver &_display;
+#endif
     const Control &_control;
+    display::WindowTransport &_transport;
+    Power _power{Power::On}, _power_target{Power::On};
     kf::gfx::Canvas<DisplayDriver::PixelImpl> _canvas{};
+    FlushStats _flush_stats{
+        .render_time = FrameTimeHistogram::defaults(),
+        .flush_time = FrameTimeHistogram::defaults(),
+    };
 
-    void onRender(kf::memory::StringView str) noexcept {
-        _canvas.background(P::black);
-        _canvas.foreground(P::white);
+    // Screen geometry: the canvas may cover only a strip of it
+    kf::math::Pixels _screen_width{0}, _screen_height{0};
+    kf::math::Pixels _screen_rows{0};// glyph rows
 
-        _canvas.fill();
+    // Screen rows drawn by the current pass: [_clip_top, _clip_bottom)
+    kf::math::Pixels _clip_top{0}, _clip_bottom{0};
+
+    // Pixels under the canvas, for glyph block copies
+    DisplayDriver::PixelImpl *_target{nullptr};
+    kf::math::Pixels _target_stride{0};
+
+    // Colors set outside of text escapes
+    DisplayDriver::PixelImpl _foreground{P::white}, _background{P::black};
+
+    KeyboardView _keyboard_view{};
+
+    // Change detection compares hashes: a colliding region would stay stale, so one band (tile row or strip) is resent
+    // per period while the panel is on. A whole frame is only resent after a transport error
+    static constexpr kf::math::Milliseconds band_refresh_period{500};
+    kf::math::Milliseconds _last_band_refresh{0};
+    kf::u8 _refresh_band{0}, _refresh_bands{1};
+    bool _band_refresh{false};
+
+    // Graphic in the framebuffer, drawn incrementally while valid
+    const ui::Graphic *_graphic_shown{nullptr};
+    bool _graphic_valid{false};
+
+    GlyphCache _glyph_cache;
+    kf::image::StaticImage<DisplayDriver::PixelImpl, GlyphCache::max_cell_width, GlyphCache::max_cell_height> _glyph_image{};
+    kf::gfx::Canvas<DisplayDriver::PixelImpl> _glyph_canvas{};
+
+#if defined(DJC_DISPLAY_STRIPS)
+    static constexpr kf::math::Pixels panel_width{160}, panel_height{128};// ClockWise orientation, see Periphery
+    static constexpr kf::math::Pixels strip_width{160};// any ST7735 orientation
+    static constexpr kf::math::Pixels strip_height{16};
+    static constexpr kf::u8 max_strips{20};// glyph rows of 6..16 px
+
+    kf::image::StaticImage<DisplayDriver::PixelImpl, strip_width, strip_height> _strip{};
+    kf::memory::Array<kf::u32, max_strips> _strip_hashes{};
+    kf::math::Pixels _strip_rows{0};// strip pixel rows in use, whole glyph rows
+    bool _strips_valid{false};
+
+    /// @brief Render and send a paced frame strip by strip, skipping unchanged strips
+    void frame(kf::memory::StringView str) noexcept {
+        if (_power_target == Power::Off) { return; }
+        if (not frame_pacer.admit(Clock::now())) { return; }
+
+        const auto start = diagnostics::cycles();
+        kf::u8 windows{0};
+        kf::u8 index{0};
+        bool failed{false};
+
+#if defined(DJC_FRAME_CAPTURE)
+        const bool capture = frame_capture.begin(_screen_width, _screen_height);
+        diagnostics::Cycles capture_cycles{0};
+#endif
+
+        const auto refresh_band = takeRefreshBand();
+
+        for (kf::math::Pixels top = 0; top < _screen_height; top += _strip_rows, index += 1) {
+            _clip_top = top;
+            _clip_bottom = static_cast<kf::math::Pixels>((top + _strip_rows < _screen_height) ? top + _strip_rows : _screen_height);
+
+            onRender(str);
+
+            const auto *pixels = _strip.data();
+
+#if defined(DJC_FRAME_CAPTURE)
+            if (capture) {
+                const auto capture_start = diagnostics::cycles();
+                frame_capture.rows(pixels, strip_width, _screen_width, _clip_bottom - _clip_top);
+                capture_cycles += diagnostics::cycles() - capture_start;
+            }
+#endif
+
+            const auto hash = stripHash(pixels, _clip_bottom - _clip_top);
+
+            if (index < max_strips) {
+                if (_strips_valid and index != refresh_band and _strip_hashes[index] == hash) { continue; }
+                _strip_hashes[index] = hash;
+            }
+
+            const display::Window window{
+                .left = 0,
+                .top = _clip_top,
+                .right = static_cast<kf::math::Pixels>(_screen_width - 1),
+                .bottom = static_cast<kf::math::Pixels>(_clip_bottom - 1),
+            };
+            failed |= not _transport.sendRegion(window, pixels, strip_width);
+            windows += 1;
+        }
+        // After a transport error the panel content is unknown: next frame resends every strip
+        _strips_valid = not failed;
+
+        // Render and transfer are interleaved: the whole pass is accounted as render time
+        auto elapsed = diagnostics::cycles() - start;
+#if defined(DJC_FRAME_CAPTURE)
+        elapsed -= capture_cycles;
+#endif
+        _flush_stats.last_render_us = elapsed / diagnostics::cyclesPerMicrosecond();
+        _flush_stats.render_time.add(_flush_stats.last_render_us);
+
+        onFrameComplete({.bytes = _transport.takeBytesSent(), .duration_us = 0, .windows = windows});
+    }
+
+    [[nodiscard]] kf::u32 stripHash(const DisplayDriver::PixelImpl *pixels, kf::math::Pixels rows) const noexcept {
+        // FNV-1a over strip pixels in use
+        kf::u32 hash{2166136261u};
+
+        const auto bytes = static_cast<kf::usize>(_screen_width) * sizeof(DisplayDriver::PixelImpl);
+
+        for (kf::math::Pixels y = 0; y < rows; y += 1) {
+            const auto *line = reinterpret_cast<const kf::u8 *>(pixels + y * strip_width);
+
+            for (kf::usize i = 0; i < bytes; i += 1) {
+                hash ^= line[i];
+                hash *= 16777619u;
+            }
+        }
+
+        return hash;
+    }
+#else
+    display::DirtyTracker<DisplayDriver::PixelImpl> _dirty_tracker{};
+    display::FlushTask<DisplayDriver::PixelImpl> _flush_task;
+    bool _render_deferred{false};
+
+    /// @brief Render a paced frame once the previous one is off the wire, then start sending changed regions
+    void frame(kf::memory::StringView str) noexcept {
+        if (_power_target == Power::Off) { return; }
+
+        // The transfer reads the framebuffer: drawing now would tear the frame on the wire
+        if (_flush_task.busy()) {
+            _flush_stats.deferred += 1;
+            _render_deferred = true;
+            return;
+        }
+
+        if (not frame_pacer.admit(Clock::now())) { return; }
+
+        const auto render_start = diagnostics::cycles();
+        onRender(str);
+        _flush_stats.last_render_us = (diagnostics::cycles() - render_start) / diagnostics::cyclesPerMicrosecond();
+        _flush_stats.render_time.add(_flush_stats.last_render_us);
+
+#if defined(DJC_FRAME_CAPTURE)
+        if (frame_capture.begin(_screen_width, _screen_height)) {
+            frame_capture.rows(_display.image().data(), _screen_width, _screen_width, _screen_height);
+        }
+#endif
+
+        flush();
+    }
+
+    /// @brief Queue framebuffer regions changed since previous flush
+    void flush() noexcept {
+        const auto *frame = _display.image().data();
+
+        const auto refresh_band = takeRefreshBand();
+        if (refresh_band >= 0) { _dirty_tracker.invalidateRow(static_cast<kf::u8>(refresh_band)); }
+
+        const auto windows = _dirty_tracker.collect(frame, _screen_width, _screen_height, [this](const display::Window &window) {
+            _flush_task.add(window);
+        });
+
+        if (windows == 0) {
+            onFrameComplete({.bytes = 0, .duration_us = 0, .windows = 0});
+            return;
+        }
+
+        _flush_task.submit(frame, _screen_width);
+    }
+#endif
+
+    /// @brief Request a frame once the band refresh period elapsed, also when the page is idle
+    void scheduleBandRefresh(kf::math::Milliseconds now) noexcept {
+        if (_band_refresh or now - _last_band_refresh < band_refresh_period) { return; }
+
+        _band_refresh = true;
+        frame_pacer.request();
+    }
+
+    /// @return Band this frame must resend, -1 if none
+    kf::i16 takeRefreshBand() noexcept {
+        if (not _band_refresh) { return -1; }
+
+        _band_refresh = false;
+        _last_band_refresh = Clock::now();
+
+        const auto band = _refresh_band;
+        _refresh_band = static_cast<kf::u8>((band + 1) % _refresh_bands);
+        return band;
+    }
+
+    /// @brief Send panel commands for a power change. The panel keeps its RAM while off, a redraw catches up on wake
+    void applyPower() noexcept {
+        if (_power == _power_target) { return; }
+
+        if (_power == Power::Off) { _transport.sleep(false); }
+        _transport.idle(_power_target == Power::Dimmed);
+        if (_power_target == Power::Off) { _transport.sleep(true); }
+
+        if (_power == Power::Off) { frame_pacer.request(); }
+        _power = _power_target;
+    }
+
+    void onFrameComplete(const FrameResult &result) noexcept {
+        _flush_stats.frames += 1;
+        _flush_stats.last_windows = result.windows;
+        _flush_stats.last_frame_bytes = result.bytes;
+        _flush_stats.total_bytes += result.bytes;
+
+        if (result.duration_us > 0) { _flush_stats.flush_time.add(result.duration_us); }
+
+#if defined(DJC_FRAME_CAPTURE)
+        frame_capture.end(_flush_stats.last_render_us, result.bytes, result.duration_us);
+#endif
+    }
+
+    // Drawing in screen coordinates, clipped to the current pass
+
+    /// @brief Draw text starting at a glyph-aligned y
+    /// @note Lines are split on '\n' and at screen width; color escapes carry over to following lines
+    void text(kf::math::Pixels x, kf::math::Pixels y, kf::memory::StringView str) noexcept {
+        const auto line_height = _canvas.glyphHeight();
+        const auto columns = static_cast<kf::usize>((_screen_width - x) / _canvas.glyphWidth());
+
+        GlyphKey key{
+            .foreground = _foreground,
+            .background = _background,
+            .reset = 0,
+            .escape_background = 0,
+            .escape_foreground = 0,
+            .code = 0,
+        };
+        kf::usize column{0};
+
+        for (kf::usize i = 0; i < str.size(); i += 1) {
+            const auto c = str.data()[i];
+            if (c == '\0') { break; }
+
+            if (c == '\n') {
+                y += line_height;
+                column = 0;
+                continue;
+            }
+
+            const auto byte = static_cast<kf::u8>(c);
+            if (byte == 0x80) {
+                key.reset = byte;
+                key.escape_background = key.escape_foreground = 0;
+                continue;
+            }
+            if ((byte & 0xF0) == 0xB0) {
+                key.escape_background = byte;
+                continue;
+            }
+            if ((byte & 0xF0) == 0xF0) {
+                key.escape_foreground = byte;
+                continue;
+            }
+
+            if (column == columns) {
+                y += line_height;
+                column = 0;
+            }
+
+            if (y >= _clip_top and y + line_height <= _clip_bottom) {
+                key.code = c;
+                glyph(static_cast<kf::math::Pixels>(x + column * _canvas.glyphWidth()), static_cast<kf::math::Pixels>(y - _clip_top), key);
+            }
+            column += 1;
+        }
+    }
+
+    /// @brief Draw one glyph at canvas coordinates: block copy of its cached cell, canvas text on cache miss
+    void glyph(kf::math::Pixels x, kf::math::Pixels y, const GlyphKey &key) noexcept {
+        const auto width = _canvas.glyphWidth();
+        const auto height = _canvas.glyphHeight();
 
+        const auto *cell = _glyph_cache.get(key, [this, &key](DisplayDriver::PixelImpl *pixels, kf::math::Pixels stride) {
+            rasterize(key, pixels, stride);
+        });
+
+        if (cell == nullptr) {
+            char buffer[5];
+            glyphString(key, buffer);
+            _canvas.text(x, y, buffer);
+            return;
+        }
+
+        for (kf::math::Pixels row = 0; row < height; row += 1) {
+            std::memcpy(_target + (y + row) * _target_stride + x, cell + row * GlyphCache::max_cell_width, width * sizeof(DisplayDriver::PixelImpl));
+        }
+    }
+
+    /// @brief Render glyph into a cache cell through the scratch canvas
+    void rasterize(const GlyphKey &key, DisplayDriver::PixelImpl *cell, kf::math::Pixels stride) noexcept {
+        char buffer[5];
+        glyphString(key, buffer);
+
+        _glyph_canvas.background(key.background);
+        _glyph_canvas.foreground(key.foreground);
+        _glyph_canvas.fill();
+        _glyph_canvas.text(0, 0, buffer);
+
+        const auto *pixels = _glyph_image.data();
+        for (kf::math::Pixels row = 0; row < _canvas.glyphHeight(); row += 1) {
+            std::memcpy(cell + row * stride, pixels + row * GlyphCache::max_cell_width, _canvas.glyphWidth() * sizeof(DisplayDriver::PixelImpl));
+        }
+    }
+
+    /// @brief Active escapes followed by the character
+    static void glyphString(const GlyphKey &key, char (&buffer)[5]) noexcept {
+        kf::usize length{0};
+        if (key.reset != 0) { buffer[length++] = static_cast<char>(key.reset); }
+        if (key.escape_background != 0) { buffer[length++] = static_cast<char>(key.escape_background); }
+        if (key.escape_foreground != 0) { buffer[length++] = static_cast<char>(key.escape_foreground); }
+        buffer[length++] = key.code;
+        buffer[length] = '\0';
+    }
+
+    void foreground(DisplayDriver::PixelImpl color) noexcept {
+        _foreground = color;
+        _canvas.foreground(color);
+    }
+
+    void background(DisplayDriver::PixelImpl color) noexcept {
+        _background = color;
+        _canvas.background(color);
+    }
+
+    /// @brief Draw rectangle, bounds inclusive
+    void rect(kf::math::Pixels x0, kf::math::Pixels y0, kf::math::Pixels x1, kf::math::Pixels y1, bool fill) noexcept {
+        if (y1 < _clip_top or y0 >= _clip_bottom) { return; }
+
+        const auto top = static_cast<kf::math::Pixels>((y0 < _clip_top ? _clip_top : y0) - _clip_top);
+        const auto bottom = static_cast<kf::math::Pixels>((y1 >= _clip_bottom ? _clip_bottom - 1 : y1) - _clip_top);
+
+        if (fill) {
+            _canvas.rect(x0, top, x1, bottom, true);
+            return;
+        }
+
+        // Outline: horizontal edges only where they fall into this pass
+        _canvas.rect(x0, top, x0, bottom, true);
+        _canvas.rect(x1, top, x1, bottom, true);
+        if (y0 >= _clip_top) { _canvas.rect(x0, top, x1, top, true); }
+        if (y1 < _clip_bottom) { _canvas.rect(x0, bottom, x1, bottom, true); }
+    }
+
+    /// @brief Graphic area drawing in area coordinates
+    struct GraphicPainter final : display::Painter {
+        DisplayManager &display;
+        kf::math::Pixels top, area_width, area_height;
+
+        GraphicPainter(DisplayManager &d, kf::math::Pixels t, kf::math::Pixels w, kf::math::Pixels h) noexcept :
+            display{d}, top{t}, area_width{w}, area_height{h} {}
+
+        [[nodiscard]] kf::math::Pixels width() const noexcept override { return area_width; }
+
+        [[nodiscard]] kf::math::Pixels height() const noexcept override { return area_height; }
+
+        [[nodiscard]] kf::math::Pixels glyphHeight() const noexcept override { return display._canvas.glyphHeight(); }
+
+        void fill(int x0, int y0, int x1, int y1, Color color) noexcept override {
+            if (x0 < 0) { x0 = 0; }
+            if (y0 < 0) { y0 = 0; }
+            if (x1 >= area_width) { x1 = area_width - 1; }
+            if (y1 >= area_height) { y1 = area_height - 1; }
+            if (x0 > x1 or y0 > y1) { return; }
+
+            display.background(color);
+            display.foreground(color);
+            display.rect(x0, top + y0, x1, top + y1, true);
+        }
+
+        void text(int x, int y, kf::memory::StringView str, Color foreground, Color background) noexcept override {
+            if (x < 0 or y < 0 or x >= area_width) { return; }
+
+            display.background(background);
+            display.foreground(foreground);
+            display.text(x, top + y, str);
+        }
+    };
+
+    // Rendering
+
+    void onRender(kf::memory::StringView str) noexcept {
         if (virtual_keyboard.active()) {
+            _graphic_valid = false;
             renderVirtualKeyboard();
-        } else {
+            return;
+        }
+        _keyboard_view.valid = false;
+
+        background(P::black);
+        foreground(P::white);
+
+        auto *graphic = graphic_view.graphic();
+        if (graphic == nullptr) {
+            _graphic_valid = false;
+            _canvas.fill();
             renderUi(str);
+            return;
         }
+
+        renderWithGraphic(str, *graphic);
     }
 
-    void renderUi(kf::memory::StringView str) noexcept {
-        // Control mode overlay
-        if (_control.enabled()) {
-            const auto y = static_cast<kf::math::Pixels>(_canvas.maxY() - _canvas.glyphHeight());
+    /// @brief Page text above the graphic area, graphic redrawn in full only when its pixels were lost
+    void renderWithGraphic(kf::memory::StringView str, ui::Graphic &graphic) noexcept {
+        const auto line_height = _canvas.glyphHeight();
+        const auto rows = static_cast<kf::math::Pixels>(graphic_view.rows() < _screen_rows - 2 ? graphic_view.rows() : _screen_rows - 2);
+        const auto area_bottom = static_cast<kf::math::Pixels>((_screen_rows - 1) * line_height);// above the control overlay row
+        const auto area_top = static_cast<kf::math::Pixels>(area_bottom - rows * line_height);
+
+#if defined(DJC_DISPLAY_STRIPS)
+        constexpr bool incremental{false};
+#else
+        const bool incremental{_graphic_valid and _graphic_shown == &graphic};
+#endif
 
-            const auto overlay = kf::memory::ArrayString<64>::formatted(
-                "\xB6\xF0""Control [%s]",
-                (_control.connected() ? EspNow::stringFromMac(_control.activeMac().value()).data() : "Disconnected"));
-            _canvas.text(0, y, overlay.data());
+        if (incremental) {
+            foreground(P::black);
+            rect(0, 0, _screen_width - 1, area_top - 1, true);
+            rect(0, area_bottom, _screen_width - 1, _screen_height - 1, true);
+        } else {
+            _canvas.fill();
         }
 
-        _canvas.background(P::black);
-        _canvas.foreground(P::white);
-        _canvas.text(0, 0, str.data());
+        renderControlOverlay();
+
+        const auto clip_top = _clip_top;
+        const auto clip_bottom = _clip_bottom;
+
+        background(P::black);
+        foreground(P::white);
+        _clip_bottom = clip_bottom < area_top ? clip_bottom : area_top;
+        text(0, 0, str);
+
+        _clip_top = clip_top > area_top ? clip_top : area_top;
+        _clip_bottom = clip_bottom < area_bottom ? clip_bottom : area_bottom;
+        if (_clip_top < _clip_bottom) {
+            GraphicPainter painter{*this, area_top, _screen_width, static_cast<kf::math::Pixels>(area_bottom - area_top)};
+            graphic.draw(painter, not incremental);
+        }
+
+        _clip_top = clip_top;
+        _clip_bottom = clip_bottom;
+
+        _graphic_shown = &graphic;
+        _graphic_valid = true;
     }
 
-    void renderVirtualKeyboard() noexcept {
-        const auto longest_row = input::VirtualKeyboard::rows[0].size();
-        const auto key_width = _canvas.width() / longest_row;
-        const auto key_height = _canvas.glyphHeight();
-        const auto keyboard_offset_y = _canvas.maxY() - key_height * virtual_keyboard.rowsTotal();
-        const auto glyph_offset_x = (key_width - _canvas.glyphWidth()) / 2;
+    void renderUi(kf::memory::StringView str) noexcept {
+        renderControlOverlay();
 
-        char c[2]{0, 0};
+        background(P::black);
+        foreground(P::white);
+        text(0, 0, str);
+    }
 
-        _canvas.text(0, 0, kf::memory::ArrayString<32>::formatted("\xBC\xF0Text Input: %d / %d\x80\n", virtual_keyboard.available(), virtual_keyboard.text().size()).data());
-        _canvas.text(0, _canvas.glyphHeight(), virtual_keyboard.text().data());
+    void renderControlOverlay() noexcept {
+        const auto &link = _control.state();
+        if (not link.enabled) { return; }
 
-        _canvas.background(P::bright_black);
-        _canvas.foreground(P::bright_black);
-        _canvas.rect(0, keyboard_offset_y, _canvas.maxX(), _canvas.maxY(), true);
+        const auto y = static_cast<kf::math::Pixels>((_screen_rows - 1) * _canvas.glyphHeight());
 
-        for (auto row = 0; row < virtual_keyboard.rowsTotal(); row += 1) {
-            const auto y = keyboard_offset_y + row * key_height;
-            const auto cols = input::VirtualKeyboard::rows[row].size();
+        const auto overlay = kf::memory::ArrayString<64>::formatted(
+            "\xB6\xF0""Control [%s]",
+            (link.connected ? EspNow::stringFromMac(link.mac).data() : "Disconnected"));
+        text(0, y, overlay.view());
+    }
 
-            const auto x_offset = ((longest_row - cols) * key_width) / 2;
+    /// @brief Redraw only what changed since the previous keyboard frame
+    /// @note Relies on the framebuffer keeping the previous frame: strip mode always redraws everything
+    void renderVirtualKeyboard() noexcept {
+        const KeyboardView view{
+            .available = virtual_keyboard.available(),
+            .row = static_cast<kf::i8>(virtual_keyboard.cursorRow()),
+            .col = static_cast<kf::i8>(virtual_keyboard.cursorCol()),
+            .shifted = virtual_keyboard.shifted(),
+            .valid = true,
+        };
 
-            for (auto col = 0; col < cols; col += 1) {
-                const auto x = col * key_width + x_offset;
+#if defined(DJC_DISPLAY_STRIPS)
+        constexpr bool incremental{false};
+#else
+        const bool incremental{_keyboard_view.valid};
+#endif
 
-                if (row == virtual_keyboard.cursorRow() and col == virtual_keyboard.cursorCol()) {
-                    _canvas.foreground(P::blue);
-                    _canvas.rect(x, y, x + key_width, y + key_height - 1, true);
+        if (not incremental) {
+            background(P::black);
+            foreground(P::white);
+            _canvas.fill();
 
-                    _canvas.background(P::blue);
-                    _canvas.foreground(P::bright_white);
-                } else {
-                    _canvas.background(P::bright_black);
-                    _canvas.foreground(P::black);
-                }
+            renderKeyboardText();
 
-                const auto &key = input::VirtualKeyboard::keyAt(row, col);
-                if (key.kind == input::VirtualKeyboard::Key::Kind::Common) {
-                    c[0] = key.value(virtual_keyboard.shifted());
-                } else {
-                    c[0] = '?';
+            background(P::bright_black);
+            foreground(P::bright_black);
+            rect(0, keyboardTop(), _screen_width - 1, _screen_height - 1, true);
+
+            for (kf::i8 row = 0; row < virtual_keyboard.rowsTotal(); row += 1) {
+                for (kf::i8 col = 0; col < static_cast<kf::i8>(input::VirtualKeyboard::rows[row].size()); col += 1) {
+                    renderKey(row, col, view);
                 }
+            }
+
+            _keyboard_view = view;
+            return;
+        }
 
-                _canvas.text(x + glyph_offset_x, y, c);
+        if (view.available != _keyboard_view.available) {
+            background(P::black);
+            foreground(P::black);
+            rect(0, 0, _screen_width - 1, keyboardTop() - 1, true);
+
+            renderKeyboardText();
+        }
+
+        if (view.shifted != _keyboard_view.shifted) {
+            // Keys whose glyph differs between shifted and plain layouts (letters, digits, symbols)
+            for (kf::i8 row = 0; row < virtual_keyboard.rowsTotal(); row += 1) {
+                for (kf::i8 col = 0; col < static_cast<kf::i8>(input::VirtualKeyboard::rows[row].size()); col += 1) {
+                    const auto &key = input::VirtualKeyboard::keyAt(row, col);
+                    if (key.kind == input::VirtualKeyboard::Key::Kind::Common and key.value(false) != key.value(true)) {
+                        renderKey(row, col, view);
+                    }
+                }
             }
         }
+
+        if (view.row != _keyboard_view.row or view.col != _keyboard_view.col) {
+            renderKey(_keyboard_view.row, _keyboard_view.col, view);
+            renderKey(view.row, view.col, view);
+        }
+
+        _keyboard_view = view;
+    }
+
+    [[nodiscard]] kf::math::Pixels keyboardTop() const noexcept {
+        return static_cast<kf::math::Pixels>((_screen_rows - virtual_keyboard.rowsTotal()) * _canvas.glyphHeight());
+    }
+
+    void renderKeyboardText() noexcept {
+        background(P::black);
+        foreground(P::white);
+
+        text(0, 0, kf::memory::ArrayString<32>::formatted("\xBC\xF0Text Input: %d / %d\x80", virtual_keyboard.available(), virtual_keyboard.text().size()).view());
+        text(0, _canvas.glyphHeight(), virtual_keyboard.text());
+    }
+
+    /// @brief Draw key cell with its background, selected if under the cursor of given view
+    void renderKey(kf::i8 row, kf::i8 col, const KeyboardView &view) noexcept {
+        const auto longest_row = input::VirtualKeyboard::rows[0].size();
+        const auto key_width = _screen_width / longest_row;
+        const auto key_height = _canvas.glyphHeight();
+        const auto glyph_offset_x = (key_width - _canvas.glyphWidth()) / 2;
+
+        const auto cols = input::VirtualKeyboard::rows[row].size();
+        const auto x = col * key_width + ((longest_row - cols) * key_width) / 2;
+        const auto y = keyboardTop() + row * key_height;
+
+        const bool selected = row == view.row and col == view.col;
+        const auto fill = selected ? P::blue : P::bright_black;
+
+        background(fill);
+        foreground(fill);
+        rect(x, y, x + key_width - 1, y + key_height - 1, true);
+
+        foreground(selected ? P::bright_white : P::black);
+
+        const auto &key = input::VirtualKeyboard::keyAt(row, col);
+        char c[2]{0, 0};
+        if (key.kind == input::VirtualKeyboard::Key::Kind::Common) {
+            c[0] = key.value(view.shifted);
+        } else {
+            c[0] = '?';
+        }
+
+        text(x + glyph_offset_x, y, c);
     }
 
     // impl
 
+    KF_IMPL_TIMED_POLLABLE(DisplayManager);
+    void pollImpl(kf::math::Milliseconds now) noexcept {
+#if not defined(DJC_DISPLAY_STRIPS)
+        const auto result = _flush_task.takeResult();
+        if (result.hasValue()) {
+            const auto &value = result.value();
+            onFrameComplete({.bytes = value.bytes, .duration_us = value.duration_us, .windows = value.windows});
+
+            // The panel may hold parts of older frames, unknown to the tracker
+            if (value.failed) {
+                _dirty_tracker.invalidate();
+                frame_pacer.request();
+            }
+        }
+
+        if (_render_deferred and not _flush_task.busy()) {
+            _render_deferred = false;
+            frame_pacer.request();
+        }
+
+        // Panel commands share the bus with the flush task
+        if (not _flush_task.busy()) { applyPower(); }
+#else
+        applyPower();
+#endif
+
+        // Dimmed and off panels are left alone: the refresh would cost more than a briefly stale tile
+        if (_power == Power::On) { scheduleBandRefresh(now); }
+        frame_pacer.poll(now, _control.state().enabled);
+    }
+
     KF_IMPL_INITABLE(DisplayManager, void);
     void initImpl() noexcept {
+#if defined(DJC_DISPLAY_STRIPS)
+        _canvas = kf::gfx::Canvas<DisplayDriver::PixelImpl>{
+            kf::image::DynamicImage<DisplayDriver::PixelImpl>{_strip},
+            kf::gfx::fonts::gyver_5x7_en,
+        };
+        _target = _strip.data();
+        _target_stride = strip_width;
+
+        _screen_width = panel_width;
+        _screen_height = panel_height;
+        _screen_rows = static_cast<kf::math::Pixels>(_screen_height / _canvas.glyphHeight());
+
+        // Whole glyph rows per strip, so text never straddles two strips
+        _strip_rows = static_cast<kf::math::Pixels>((strip_height / _canvas.glyphHeight()) * _canvas.glyphHeight());
+        _strips_valid = false;
+        _refresh_bands = static_cast<kf::u8>((_screen_height + _strip_rows - 1) / _strip_rows);
+#else
         _canvas = kf::gfx::Canvas<DisplayDriver::PixelImpl>{
             kf::image::DynamicImage<DisplayDriver::PixelImpl>{_display.image()},
             kf::gfx::fonts::gyver_5x7_en,
         };
+        _target = _display.image().data();
+
+        _screen_width = _canvas.width();
+        _screen_height = _canvas.height();
+        _screen_rows = _canvas.heightInGlyphs();
+        _target_stride = _screen_width;
+
+        _clip_top = 0;
+        _clip_bottom = _screen_height;
+
+        _dirty_tracker.invalidate();
+        _refresh_bands = decltype(_dirty_tracker)::rowsOf(_screen_height);
+        (void) _flush_task.init();
+#endif
         _canvas.autoNextLine(true);
 
+        _glyph_canvas = kf::gfx::Canvas<DisplayDriver::PixelImpl>{
+            kf::image::DynamicImage<DisplayDriver::PixelImpl>{_glyph_image},
+            kf::gfx::fonts::gyver_5x7_en,
+        };
+        if (not _glyph_cache.cell(_canvas.glyphWidth(), _canvas.glyphHeight())) {
+            logger.error("glyph does not fit cache cell, text drawn uncached");
+        }
+
+        _flush_stats.full_frame_bytes = static_cast<kf::u32>(_screen_width) * _screen_height * sizeof(DisplayDriver::PixelImpl);
+
         auto &config = ui::UI::instance().renderConfig();
         config.callback([this](kf::memory::StringView str) {
-            onRender(str);
-            (void) _display.send();
+            frame(str);
         });
         config.row_max_length = _canvas.widthInGlyphs();
-        config.rows_total = _canvas.heightInGlyphs() - 1;
+        config.rows_total = _screen_rows - 1;
+
+#if defined(DJC_DISPLAY_STRIPS)
+        constexpr kf::u32 framebuffer_bytes{0};// no driver
+#else
+        const auto framebuffer_bytes = _flush_stats.full_frame_bytes;
+#endif
+        logger.info(
+            kf::memory::ArrayString<96>::formatted(
+                "RAM: manager %u B, driver framebuffer %lu B, free heap %lu B",
+                static_cast<unsigned>(sizeof(DisplayManager)),
+                static_cast<unsigned long>(framebuffer_bytes),
+                static_cast<unsigned long>(ESP.getFreeHeap()))
+                .view());
     }
 };
 
-}// namespace djc
\ No newline at end of file
+}// namespace djc
@@ -10,16 +10,36 @@
 #include <kf/Logger.hpp>
 #include <kf/Option.hpp>
 #include <kf/aliases.hpp>
+#include <kf/math/units.hpp>
 #include <kf/mixin/Configurable.hpp>
 #include <kf/mixin/Initable.hpp>
 #include <kf/mixin/NonCopyable.hpp>
 
+#include "djc/diagnostics/LatencyTracer.hpp"
+#include "djc/display/WindowTransport.hpp"
+#include "djc/input/InputFrame.hpp"
 #include "djc/prelude.hpp"
 
 namespace djc {
 
 namespace internal {
 
+// Buttons wiring (active low), also light sleep wake sources
+constexpr auto left_button_pin{GPIO_NUM_14};
+constexpr auto right_button_pin{GPIO_NUM_4};
+
+// Display wiring
+constexpr auto display_mosi_pin{GPIO_NUM_23};
+constexpr auto display_clock_pin{GPIO_NUM_18};
+constexpr auto display_cs_pin{GPIO_NUM_5};
+constexpr auto display_dc_pin{GPIO_NUM_22};
+constexpr auto display_reset_pin{GPIO_NUM_17};
+constexpr kf::u32 display_spi_frequency{27000000};
+// Visible area position in panel RAM, for the ClockWise orientation below: 0, 0 on black and red tab 160x128 panels, 1, 2 on green tab ones
+constexpr djc::display::WindowTransport::Offset display_offset{.column = 0, .row = 0};
+// MADCTL of the ClockWise orientation (MY | MV, RGB order), for panel init without the driver
+constexpr kf::u8 display_orientation{0xA0};
+
 struct PeripheryConfig final : kf::mixin::NonCopyable {
     ButtonListener::Config button;
 
@@ -52,7 +72,7 @@ struct PeripheryConfig final : kf::mixin::NonCopyable {
             // SPI default pins: MOSI=23, MISO=19, SCK=18
             .bus = djc::Bus::Config::create(),
             // CS, SPI frequency
-            .bus_node = djc::Bus::Node::Config::create(GPIO_NUM_5, 27000000),
+            .bus_node = djc::Bus::Node::Config::create(display_cs_pin, display_spi_frequency),
             .display = {
                 .init_orientation = kf::drivers::display::Orientation::ClockWise,
             },
@@ -83,7 +103,7 @@ struct Periphery final : kf::mixin::NonCopyable, kf::mixin::Initable<Periphery,
     ButtonListener left_button_listener{
         this->config().button,
         DigitalInput{
-            GPIO_NUM_14,
+            internal::left_button_pin,
             DigitalInput::Pull::InternalUp,
         },
     };
@@ -98,7 +118,7 @@ struct Periphery final : kf::mixin::NonCopyable, kf::mixin::Initable<Periphery,
     ButtonListener right_button_listener{
         this->config().button,
         DigitalInput{
-            GPIO_NUM_4,
+            internal::right_button_pin,
             DigitalInput::Pull::InternalUp,
         },
     };
@@ -110,6 +130,7 @@ struct Periphery final : kf::mixin::NonCopyable, kf::mixin::Initable<Periphery,
         AdcInput{GPIO_NUM_35},
     };
 
+#if not defined(DJC_DISPLAY_STRIPS)
     Bus bus{
         this->config().bus,
         SPI,
@@ -118,10 +139,58 @@ struct Periphery final : kf::mixin::NonCopyable, kf::mixin::Initable<Periphery,
     DisplayDriver display{
         this->config().display,
         bus.createNode(this->config().bus_node),
-        DigitalOutput{GPIO_NUM_22},// DC
-        DigitalOutput{GPIO_NUM_17},// RESET
+        DigitalOutput{internal::display_dc_pin},   // DC
+        DigitalOutput{internal::display_reset_pin},// RESET
+    };
+#endif
+
+    // Partial (windowed) frame updates by DMA, takes the bus over once the display driver initialized the panel.
+    // Strip mode has no driver (nor its framebuffer): the transport initializes the panel itself
+    djc::display::WindowTransport display_transport{
+        SPI,
+        SPI3_HOST,// VSPI, the Arduino SPI default
+        {
+            .mosi = internal::display_mosi_pin,
+            .clock = internal::display_clock_pin,
+            .chip_select = internal::display_cs_pin,
+            .data_command = internal::display_dc_pin,
+        },
+        internal::display_offset,
+        internal::display_spi_frequency,
     };
 
+    /// @brief Sample every axis and button exactly once
+    /// @note Consumes pending button clicks: the frame is the only source of click edges
+    [[nodiscard]] input::InputFrame sample(kf::math::Milliseconds now) noexcept {
+        left_button_listener.poll(now);
+        right_button_listener.poll(now);
+
+        DJC_LATENCY_MARK(AdcSample);
+
+        const input::InputFrame frame{
+            .timestamp = now,
+            .left_joystick = {
+                .x = left_joystick.axis_x.read(),
+                .y = left_joystick.axis_y.read(),
+            },
+            .right_joystick = {
+                .x = right_joystick.axis_x.read(),
+                .y = right_joystick.axis_y.read(),
+            },
+            .left_button = {
+                .pressed = left_button_listener.pressed(),
+                .clicked = left_button_listener.clicked(),
+            },
+            .right_button = {
+                .pressed = right_button_listener.pressed(),
+                .clicked = right_button_listener.clicked(),
+            },
+        };
+
+        DJC_LATENCY_MARK(FilterOutput);
+        return frame;
+    }
+
     // Analog axis calibration
     void tune(Config &mut_config) noexcept {
         Joystick::Tuner left_tuner{mut_config.left_joystick, left_joystick, mut_config.joystick_axes_tune_samples};
@@ -153,6 +222,11 @@ private:
         left_button_listener.init();
         right_button_listener.init();
 
+#if defined(DJC_DISPLAY_STRIPS)
+        if (not display_transport.init() or not display_transport.initPanel(internal::display_reset_pin, internal::display_orientation)) {
+            logger.error("Display transport initialization failed");
+        }
+#else
         if (bus.init().isError()) {
             logger.error("Bus initialization failed");
         }
@@ -161,6 +235,11 @@ private:
             logger.error("Display driver initialization failed");
         }
 
+        if (not display_transport.init()) {
+            logger.error("Display transport initialization failed");
+        }
+#endif
+
         logger.info("Peripherals initialized successfully");
         return true;
     }
@@ -0,0 +1,387 @@
+// Copyright (c) 2026 KiraFlux
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#pragma once
+
+#include <utility>
+
+#include <Arduino.h>// for micros, Serial
+#include <driver/gpio.h>
+#include <esp_sleep.h>
+
+#include <kf/Logger.hpp>
+#include <kf/aliases.hpp>
+#include <kf/math/units.hpp>
+#include <kf/memory/Array.hpp>
+#include <kf/memory/ArrayString.hpp>
+#include <kf/memory/StringView.hpp>
+#include <kf/mixin/Configurable.hpp>
+#include <kf/mixin/NonCopyable.hpp>
+#include <kf/mixin/TimedPollable.hpp>
+
+#include "djc/Clock.hpp"
+#include "djc/ConfigManager.hpp"
+#include "djc/Control.hpp"
+#include "djc/DisplayManager.hpp"
+#include "djc/Periphery.hpp"
+#include "djc/input/InputFrame.hpp"
+#include "djc/memory/InplaceFunction.hpp"
+
+namespace djc {
+
+namespace internal {
+
+struct PowerManagerConfig {
+    kf::math::Milliseconds dim_timeout;  // without input activity
+    kf::math::Milliseconds slow_timeout; // polling rates dropped
+    kf::math::Milliseconds sleep_timeout;// light sleep, buttons wake
+    kf::math::Milliseconds wake_guard;   // input ignored after a wake, until buttons are released
+    kf::f32 axis_threshold;              // stick deflection counted as activity
+    kf::u8 slow_stretch;                 // main loop period factor while slow
+    kf::math::Milliseconds slow_control_period;
+    kf::memory::Array<kf::u16, 4> current_ma;// estimated draw per state (3.3 V rail), not measured
+
+    static constexpr PowerManagerConfig defaults() noexcept {
+        return PowerManagerConfig{
+            .dim_timeout = 20000,
+            .slow_timeout = 60000,
+            .sleep_timeout = 180000,
+            .wake_guard = 250,
+            .axis_threshold = 0.15f,
+            .slow_stretch = 5,
+            .slow_control_period = 100,
+            // Wi-Fi RX ~100 mA dominates while awake; the backlight (~20 mA) is wired to 5 V and stays lit
+            .current_ma = {130, 125, 115, 25},
+        };
+    }
+};
+
+}// namespace internal
+
+/// @brief Hardware side of light sleep, replaced by a simulated one to run the state machine without sleeping
+struct SleepBackend {
+    virtual ~SleepBackend() = default;
+
+    /// @brief Sleep until a button is pressed
+    /// @return false if the sleep was rejected
+    virtual bool lightSleep() noexcept = 0;
+};
+
+/// @brief ESP32 light sleep, woken by a low level on either button
+struct EspSleepBackend final : SleepBackend {
+
+    bool lightSleep() noexcept override {
+        Serial.flush();// UART output pending at sleep is lost
+
+        (void) gpio_wakeup_enable(internal::left_button_pin, GPIO_INTR_LOW_LEVEL);
+        (void) gpio_wakeup_enable(internal::right_button_pin, GPIO_INTR_LOW_LEVEL);
+        (void) esp_sleep_enable_gpio_wakeup();
+
+        const auto result = esp_light_sleep_start();
+
+        (void) gpio_wakeup_disable(internal::left_button_pin);
+        (void) gpio_wakeup_disable(internal::right_button_pin);
+
+        return result == ESP_OK;
+    }
+};
+
+/// @brief Idle power saving driven by input activity: dims the display, then drops polling rates, then light sleeps
+/// @details Runs on the main loop. Light sleep does not keep Wi-Fi, so the radio is suspended through Control first and
+/// the previous peer is reconnected on wake. Only the buttons wake the device; the waking press does not navigate.
+/// While control is enabled the link keeps its rate: power saving stops at dimming
+struct PowerManager final : kf::mixin::NonCopyable, kf::mixin::TimedPollable<PowerManager>, kf::mixin::Configurable<internal::PowerManagerConfig> {
+    using Config = internal::PowerManagerConfig;
+
+    enum class State : kf::u8 {
+        Active,
+        Dimmed,
+        Slow,
+        Sleep,
+    };
+
+    static constexpr kf::u8 states_total{4};
+
+    using StateCallback = memory::InplaceFunction<void(State)>;
+
+    struct Stats {
+        kf::memory::Array<kf::u64, states_total> time_ms;// spent per state
+        kf::u32 sleeps;
+        kf::u32 resumes;       // confirmed by Control, including sleeps cancelled by input
+        kf::u32 last_resume_us;// wake to radio and peer restored
+        kf::u32 max_resume_us;
+        kf::u32 peers_lost;    // peers not restored on wake
+    };
+
+    explicit PowerManager(const Config &config, Control &control, DisplayManager &display_manager, SleepBackend &sleep_backend) noexcept :
+        kf::mixin::Configurable<Config>{config}, _control{control}, _display_manager{display_manager}, _sleep_backend{sleep_backend} {}
+
+    /// @brief Apply polling rates of a state (scheduler, control task)
+    void onStateChange(StateCallback &&callback) noexcept { _state_callback = std::move(callback); }
+
+    [[nodiscard]] State state() const noexcept { return _state; }
+
+    [[nodiscard]] const Stats &stats() const noexcept { return _stats; }
+
+    [[nodiscard]] static constexpr kf::memory::StringView stringFromState(State state) noexcept {
+        constexpr kf::memory::StringView names[states_total]{"Active", "Dimmed", "Slow", "Sleep"};
+        return names[static_cast<kf::u8>(state)];
+    }
+
+    /// @brief Estimated draw in the current state
+    [[nodiscard]] kf::u16 currentMa() const noexcept { return this->config().current_ma[static_cast<kf::u8>(_state)]; }
+
+    /// @brief Estimated average draw since boot
+    [[nodiscard]] kf::u32 averageCurrentMa(kf::math::Milliseconds now) const noexcept {
+        kf::u64 charge{0}, time{0};
+
+        for (kf::u8 i = 0; i < states_total; i += 1) {
+            auto spent = _stats.time_ms[i];
+            if (i == static_cast<kf::u8>(_state)) { spent += now - _state_since; }
+
+            charge += spent * this->config().current_ma[i];
+            time += spent;
+        }
+
+        return time == 0 ? currentMa() : static_cast<kf::u32>(charge / time);
+    }
+
+    /// @brief Feed an input frame: activity postpones power saving and wakes from it
+    /// @return false for frames of the press that woke the device from sleep: they must not reach navigation
+    bool activity(const input::InputFrame &frame) noexcept {
+        const bool held = frame.left_button.pressed or frame.right_button.pressed;
+
+        if (_swallow) {
+            // Frames sampled before the sleep may still be queued: compare, do not subtract
+            if (held or frame.timestamp < _wake_at + this->config().wake_guard) { return false; }
+            _swallow = false;
+        }
+
+        if (not held and not deflected(frame.left_joystick) and not deflected(frame.right_joystick)) { return true; }
+
+        _last_activity = frame.timestamp;
+
+        if (_state == State::Sleep) {
+            // Input before the radio went down: cancel the sleep
+            wake(frame.timestamp);
+        } else if (_state != State::Active) {
+            enter(State::Active, frame.timestamp);
+        }
+
+        return true;
+    }
+
+    /// @brief Write state, estimated current and resume timing to the log (serial)
+    void report() const noexcept {
+        const auto now = Clock::now();
+        const auto name = stringFromState(_state);
+
+        logger.info(
+            kf::memory::ArrayString<144>::formatted(
+                "%.*s: ~%u mA, avg ~%lu mA | sleeps %lu resumes %lu | resume last %lu max %lu us | peers lost %lu",
+                static_cast<int>(name.size()), name.data(),
+                static_cast<unsigned>(currentMa()),
+                static_cast<unsigned long>(averageCurrentMa(now)),
+                static_cast<unsigned long>(_stats.sleeps),
+                static_cast<unsigned long>(_stats.resumes),
+                static_cast<unsigned long>(_stats.last_resume_us),
+                static_cast<unsigned long>(_stats.max_resume_us),
+                static_cast<unsigned long>(_stats.peers_lost))
+                .view());
+
+        for (kf::u8 i = 0; i < states_total; i += 1) {
+            const auto state_name = stringFromState(static_cast<State>(i));
+            auto spent = _stats.time_ms[i];
+            if (i == static_cast<kf::u8>(_state)) { spent += now - _state_since; }
+
+            logger.info(
+                kf::memory::ArrayString<48>::formatted(
+                    "%.*s: %lu s",
+                    static_cast<int>(state_name.size()), state_name.data(),
+                    static_cast<unsigned long>(spent / 1000))
+                    .view());
+        }
+    }
+
+private:
+    static constexpr auto logger{kf::Logger::create("PowerManager")};
+
+    inline static auto &storage = ConfigManager::instance();
+
+    Control &_control;
+    DisplayManager &_display_manager;
+    SleepBackend &_sleep_backend;
+    StateCallback _state_callback{};
+    Stats _stats{};
+
+    State _state{State::Active};
+    kf::math::Milliseconds _state_since{0};
+    kf::math::Milliseconds _last_activity{0};
+
+    // Suspend and resume requests are numbered, Control echoes the number of the last one it executed
+    kf::u8 _power_sequence{0};
+
+    // Sleep entry: radio suspend requested, waiting for Control to stop it
+    bool _suspend_posted{false};
+    kf::u8 _suspend_sequence{0};
+    bool _peer_before_sleep{false};
+
+    // Wake: radio resume requested, waiting for Control to restore it
+    bool _resuming{false};
+    bool _resume_posted{false};
+    kf::u8 _resume_sequence{0};
+    kf::u32 _wake_us{0};
+
+    // Waking press in progress
+    bool _swallow{false};
+    kf::math::Milliseconds _wake_at{0};
+
+    [[nodiscard]] bool deflected(const input::InputFrame::Axes &axes) const noexcept {
+        const auto threshold = this->config().axis_threshold;
+        return axes.x > threshold or axes.x < -threshold or axes.y > threshold or axes.y < -threshold;
+    }
+
+    /// @brief Deepest state allowed after this much idle time
+    [[nodiscard]] State stateFor(kf::math::Milliseconds idle) const noexcept {
+        const auto &config = this->config();
+        const bool link_driven = _control.state().enabled;
+
+        if (idle >= config.dim_timeout and link_driven) { return State::Dimmed; }
+        if (idle >= config.sleep_timeout) { return State::Sleep; }
+        if (idle >= config.slow_timeout) { return State::Slow; }
+        if (idle >= config.dim_timeout) { return State::Dimmed; }
+        return State::Active;
+    }
+
+    /// @return Request posted, its sequence stored
+    bool postSuspend() noexcept {
+        const auto sequence = static_cast<kf::u8>(_power_sequence + 1);
+        if (not _control.requestSuspend(sequence)) { return false; }
+
+        _power_sequence = sequence;
+        _suspend_sequence = sequence;
+        return true;
+    }
+
+    bool postResume() noexcept {
+        const auto sequence = static_cast<kf::u8>(_power_sequence + 1);
+        if (not _control.requestResume(sequence)) { return false; }
+
+        _power_sequence = sequence;
+        _resume_sequence = sequence;
+        return true;
+    }
+
+    /// @brief Control executed the request, and every one posted before it
+    [[nodiscard]] bool acknowledged(kf::u8 sequence) noexcept { return _control.state().power_ack == sequence; }
+
+    void enter(State new_state, kf::math::Milliseconds now) noexcept {
+        if (new_state == _state) { return; }
+
+        _stats.time_ms[static_cast<kf::u8>(_state)] += now - _state_since;
+        _state_since = now;
+        _state = new_state;
+
+        switch (_state) {
+            case State::Active:
+                _display_manager.power(DisplayManager::Power::On);
+                break;
+
+            case State::Dimmed:
+            case State::Slow:
+                _display_manager.power(DisplayManager::Power::Dimmed);
+                break;
+
+            case State::Sleep:
+                _display_manager.power(DisplayManager::Power::Off);
+                _peer_before_sleep = _control.state().connected;
+                _suspend_posted = postSuspend();
+                break;
+        }
+
+        if (_state_callback) { _state_callback(_state); }
+
+        const auto name = stringFromState(_state);
+        logger.debug(kf::memory::ArrayString<32>::formatted("-> %.*s", static_cast<int>(name.size()), name.data()).view());
+    }
+
+    /// @brief Leave sleep (after light sleep, or before it when input came first)
+    void wake(kf::math::Milliseconds now) noexcept {
+        _wake_us = static_cast<kf::u32>(micros());
+        _resuming = true;
+        _resume_posted = postResume();
+        _last_activity = now;
+        enter(State::Active, now);
+    }
+
+    /// @brief Light sleep until a button is pressed. Time keeps running (millis is compensated)
+    void lightSleep() noexcept {
+        logger.info("light sleep");
+
+        _stats.sleeps += 1;
+        if (not _sleep_backend.lightSleep()) { logger.error("light sleep rejected"); }
+
+        const auto now = Clock::now();
+        _swallow = true;
+        _wake_at = now;
+        wake(now);
+    }
+
+    /// @brief Resume latency once Control reports the radio (and peer) back
+    /// @details Waits for Control to acknowledge the resume request: input may cancel a sleep before Control executed
+    /// the suspend, then the radio is only back once both ran
+    void checkResumed() noexcept {
+        if (not _resume_posted) {
+            _resume_posted = postResume();
+            return;
+        }
+
+        if (not acknowledged(_resume_sequence)) { return; }
+
+        const auto &link = _control.state();
+        if (link.suspended) { return; }
+
+        _resuming = false;
+        _stats.resumes += 1;
+
+        _stats.last_resume_us = static_cast<kf::u32>(micros()) - _wake_us;
+        if (_stats.last_resume_us > _stats.max_resume_us) { _stats.max_resume_us = _stats.last_resume_us; }
+
+        if (_peer_before_sleep and not link.connected) {
+            _stats.peers_lost += 1;
+            logger.error("peer not restored");
+        }
+        _peer_before_sleep = false;
+
+        logger.info(kf::memory::ArrayString<32>::formatted("resumed in %lu us", static_cast<unsigned long>(_stats.last_resume_us)).view());
+    }
+
+    // impl
+
+    KF_IMPL_TIMED_POLLABLE(PowerManager);
+    void pollImpl(kf::math::Milliseconds now) noexcept {
+        if (_resuming) {
+            checkResumed();
+            return;
+        }
+
+        if (_state == State::Sleep) {
+            if (not _suspend_posted) {
+                _suspend_posted = postSuspend();
+                return;
+            }
+
+            // Pending config reaches flash before sleep, a commit must not be frozen halfway
+            if (storage.modified()) { storage.save(); }
+
+            // Radio stopped, panel off, flash quiet: nothing left awake
+            if (acknowledged(_suspend_sequence) and _control.state().suspended and _display_manager.power() == DisplayManager::Power::Off and storage.settled()) { lightSleep(); }
+            return;
+        }
+
+        const auto target = stateFor(now - _last_activity);
+        if (target > _state) { enter(target, now); }
+    }
+};
+
+}// namespace djc
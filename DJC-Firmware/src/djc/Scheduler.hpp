@@ -0,0 +1,219 @@
+// Copyright (c) 2026 KiraFlux
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#pragma once
+
+#include <utility>
+
+#include <kf/Logger.hpp>
+#include <kf/aliases.hpp>
+#include <kf/math/units.hpp>
+#include <kf/memory/Array.hpp>
+#include <kf/memory/ArrayString.hpp>
+#include <kf/memory/StringView.hpp>
+#include <kf/mixin/NonCopyable.hpp>
+
+#include "djc/Clock.hpp"
+#include "djc/diagnostics/Cycles.hpp"
+#include "djc/memory/InplaceFunction.hpp"
+
+namespace djc {
+
+/// @brief Deadline-driven cooperative scheduler of the main loop
+/// @details Every task has a period and a priority. A step sleeps until the earliest deadline, then runs the tasks due
+/// at that moment, lowest priority value first. Deadlines advance by whole periods from the first one, so timing does
+/// not drift with the work done; a task that fell more than a period behind skips the missed runs instead of bursting
+struct Scheduler final : kf::mixin::NonCopyable {
+
+    static constexpr kf::u8 max_tasks{8};
+
+    using Run = memory::InplaceFunction<void(kf::math::Milliseconds)>;
+
+    /// @brief Called every step with its lateness past the earliest deadline
+    using StepObserver = memory::InplaceFunction<void(kf::math::Milliseconds)>;
+
+    /// @brief Per-task timing
+    struct Stats {
+        kf::u32 runs;
+        kf::u32 skipped;    // periods missed entirely
+        kf::u32 last_run_us;
+        kf::u32 max_run_us;
+        kf::u64 total_run_us;
+        kf::u32 max_late_ms;// start after the deadline
+        kf::u64 total_late_ms;
+    };
+
+    /// @brief Register a task, first run at the next step
+    /// @param priority Lower runs first among tasks due together
+    /// @return false if no room is left
+    bool add(kf::memory::StringView name, kf::math::Milliseconds period, kf::u8 priority, Run &&run) noexcept {
+        if (_tasks_total == max_tasks) {
+            logger.error("no room for task");
+            return false;
+        }
+
+        if (period == 0) {
+            logger.error("task period must not be zero");
+            return false;
+        }
+
+        auto &task = _tasks[_tasks_total];
+        task.name = name;
+        task.period = period;
+        task.priority = priority;
+        task.deadline = Clock::now();
+        task.run = std::move(run);
+        task.stats = {};
+
+        _tasks_total += 1;
+        return true;
+    }
+
+    void onStep(StepObserver &&observer) noexcept { _step_observer = std::move(observer); }
+
+    /// @brief Register a TimedPollable, polled once per period
+    template<typename P> bool add(kf::memory::StringView name, P &pollable, kf::math::Milliseconds period, kf::u8 priority) noexcept {
+        return add(name, period, priority, [&pollable](kf::math::Milliseconds now) { pollable.poll(now); });
+    }
+
+    /// @brief Wait for the earliest deadline and run every due task
+    void step() noexcept {
+        if (_tasks_total == 0) { return; }
+
+        auto now = Clock::now();
+        const auto deadline = earliestDeadline();
+
+        if (deadline > now) {
+            const auto idle = deadline - now;
+            _idle_ms += idle;
+            Clock::sleep(idle);
+            now = Clock::now();
+        }
+
+        if (_step_observer) { _step_observer(now - deadline); }
+
+        kf::u8 due{0};
+        kf::memory::Array<bool, max_tasks> pending{};
+        for (kf::u8 i = 0; i < _tasks_total; i += 1) {
+            pending[i] = _tasks[i].deadline <= now;
+            if (pending[i]) { due += 1; }
+        }
+
+        for (; due > 0; due -= 1) {
+            const auto index = nextPending(pending);
+            pending[index] = false;
+            runTask(_tasks[index], now, _stretch);
+        }
+
+        _steps += 1;
+    }
+
+    /// @brief Multiply every period (power saving), deadlines restart from now
+    void stretch(kf::u8 factor) noexcept {
+        if (factor == 0 or factor == _stretch) { return; }
+
+        _stretch = factor;
+
+        const auto now = Clock::now();
+        for (kf::u8 i = 0; i < _tasks_total; i += 1) { _tasks[i].deadline = now; }
+    }
+
+    [[nodiscard]] kf::u8 stretch() const noexcept { return _stretch; }
+
+    [[nodiscard]] kf::u8 tasksTotal() const noexcept { return _tasks_total; }
+
+    [[nodiscard]] kf::memory::StringView name(kf::u8 index) const noexcept { return _tasks[index].name; }
+
+    [[nodiscard]] const Stats &stats(kf::u8 index) const noexcept { return _tasks[index].stats; }
+
+    /// @brief Time spent sleeping between steps
+    [[nodiscard]] kf::u64 idleMs() const noexcept { return _idle_ms; }
+
+    /// @brief Write every task timing to the log (serial)
+    void report() const noexcept {
+        logger.info(kf::memory::ArrayString<48>::formatted("steps %lu idle %lu ms", static_cast<unsigned long>(_steps), static_cast<unsigned long>(_idle_ms)).view());
+        logger.info("task: runs skipped | run avg max us | late avg max ms");
+
+        for (kf::u8 i = 0; i < _tasks_total; i += 1) {
+            const auto &task = _tasks[i];
+            const auto &s = task.stats;
+            const auto runs = s.runs > 0 ? s.runs : 1;
+
+            logger.info(
+                kf::memory::ArrayString<96>::formatted(
+                    "%.*s: %lu %lu | %lu %lu | %lu %lu",
+                    static_cast<int>(task.name.size()), task.name.data(),
+                    static_cast<unsigned long>(s.runs),
+                    static_cast<unsigned long>(s.skipped),
+                    static_cast<unsigned long>(s.total_run_us / runs),
+                    static_cast<unsigned long>(s.max_run_us),
+                    static_cast<unsigned long>(s.total_late_ms / runs),
+                    static_cast<unsigned long>(s.max_late_ms))
+                    .view());
+        }
+    }
+
+private:
+    static constexpr auto logger{kf::Logger::create("Scheduler")};
+
+    struct Task {
+        kf::memory::StringView name{};
+        kf::math::Milliseconds period{0};
+        kf::u8 priority{0};
+        kf::math::Milliseconds deadline{0};
+        Run run{};
+        Stats stats{};
+    };
+
+    kf::memory::Array<Task, max_tasks> _tasks{};
+    kf::u8 _tasks_total{0};
+    kf::u32 _steps{0};
+    kf::u64 _idle_ms{0};
+    kf::u8 _stretch{1};
+    StepObserver _step_observer{};
+
+    [[nodiscard]] kf::math::Milliseconds earliestDeadline() const noexcept {
+        auto earliest = _tasks[0].deadline;
+        for (kf::u8 i = 1; i < _tasks_total; i += 1) {
+            if (_tasks[i].deadline < earliest) { earliest = _tasks[i].deadline; }
+        }
+        return earliest;
+    }
+
+    /// @brief Pending task of the best priority, first registered on ties
+    [[nodiscard]] kf::u8 nextPending(const kf::memory::Array<bool, max_tasks> &pending) const noexcept {
+        kf::u8 best{max_tasks};
+        for (kf::u8 i = 0; i < _tasks_total; i += 1) {
+            if (not pending[i]) { continue; }
+            if (best == max_tasks or _tasks[i].priority < _tasks[best].priority) { best = i; }
+        }
+        return best;
+    }
+
+    static void runTask(Task &task, kf::math::Milliseconds now, kf::u8 stretch) noexcept {
+        auto &s = task.stats;
+
+        const auto late = now - task.deadline;
+        s.total_late_ms += late;
+        if (late > s.max_late_ms) { s.max_late_ms = late; }
+
+        const auto start = diagnostics::cycles();
+        task.run(now);
+        const auto run_us = (diagnostics::cycles() - start) / diagnostics::cyclesPerMicrosecond();
+
+        s.runs += 1;
+        s.last_run_us = run_us;
+        s.total_run_us += run_us;
+        if (run_us > s.max_run_us) { s.max_run_us = run_us; }
+
+        const auto period = task.period * stretch;
+        task.deadline += period;
+        if (task.deadline <= now) {
+            const auto missed = (now - task.deadline) / period + 1;
+            s.skipped += missed;
+            task.deadline += missed * period;
+        }
+    }
+};
+
+}// namespace djc
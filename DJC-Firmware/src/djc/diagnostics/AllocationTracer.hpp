@@ -0,0 +1,170 @@
+// Copyright (c) 2026 KiraFlux
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#pragma once
+
+#include <atomic>
+#include <cstdlib>
+
+#if defined(ARDUINO)
+#include <Arduino.h>// for xTaskGetCurrentTaskHandle
+#endif
+
+#include <kf/Logger.hpp>
+#include <kf/aliases.hpp>
+#include <kf/memory/Array.hpp>
+#include <kf/memory/ArrayString.hpp>
+#include <kf/mixin/Singleton.hpp>
+
+/// Heap allocation tracing through replaced operator new / delete and the wrapped C allocator (see main.cpp).
+/// `-D DJC_ALLOC_TRACE` counts allocations per call site; `-D DJC_ALLOC_ASSERT` also aborts on the first
+/// allocation made by the loop task (or the control task) after setup()
+#if defined(DJC_ALLOC_ASSERT) and not defined(DJC_ALLOC_TRACE)
+#define DJC_ALLOC_TRACE
+#endif
+
+namespace djc::diagnostics {
+
+/// @brief Counts heap allocations per call site (return address of operator new, malloc, calloc or realloc)
+/// @details Lock-free for callers: an allocation made while the table is busy (other core, or the tracer itself
+/// logging) is counted as untracked instead of waiting. Resolve sites with `addr2line -e firmware.elf <address>`
+struct AllocationTracer final : kf::mixin::Singleton<AllocationTracer> {
+
+    static constexpr kf::u16 sites_total{64};// power of two
+
+    struct Site {
+        const void *address;
+        kf::u32 count;
+        kf::u32 bytes;
+        kf::u32 loop_count;// made by the loop or control task after arm()
+    };
+
+    /// @brief Called by operator new and the C allocator wrappers
+    void allocated(const void *site, kf::usize size) noexcept {
+        const bool from_loop = _armed.load(std::memory_order_relaxed) and
+                               (currentTask() == _loop_task or currentTask() == _control_task.load(std::memory_order_relaxed));
+
+        if (_lock.test_and_set(std::memory_order_acquire)) {
+            _untracked.fetch_add(1, std::memory_order_relaxed);
+            return;
+        }
+
+        _allocations += 1;
+        if (from_loop) { _loop_allocations += 1; }
+
+        if (auto *entry = siteOf(site)) {
+            entry->count += 1;
+            entry->bytes += static_cast<kf::u32>(size);
+            if (from_loop) { entry->loop_count += 1; }
+        } else {
+            _untracked.fetch_add(1, std::memory_order_relaxed);
+        }
+
+        _lock.clear(std::memory_order_release);
+
+#if defined(DJC_ALLOC_ASSERT)
+        if (from_loop) { violation(site, size); }
+#endif
+    }
+
+    /// @brief Called by operator delete and free
+    void freed() noexcept { _frees.fetch_add(1, std::memory_order_relaxed); }
+
+    /// @brief Setup is over: allocations of the calling task are loop allocations from now on
+    void arm() noexcept {
+        _loop_task = currentTask();
+        _armed.store(true, std::memory_order_release);
+        logger.info("armed: loop must not allocate");
+    }
+
+    /// @brief Allocations of the calling task count as loop allocations too (control task on the other core)
+    void watch() noexcept { _control_task.store(currentTask(), std::memory_order_relaxed); }
+
+    [[nodiscard]] kf::u32 loopAllocations() const noexcept { return _loop_allocations; }
+
+    /// @brief Write every call site to the log (serial)
+    void dump() noexcept {
+        // Logging may allocate: do not count it against the loop
+        const auto armed = _armed.exchange(false, std::memory_order_acq_rel);
+
+        logger.info(
+            kf::memory::ArrayString<96>::formatted(
+                "allocs %lu frees %lu untracked %lu, in loop %lu",
+                static_cast<unsigned long>(_allocations),
+                static_cast<unsigned long>(_frees.load(std::memory_order_relaxed)),
+                static_cast<unsigned long>(_untracked.load(std::memory_order_relaxed)),
+                static_cast<unsigned long>(_loop_allocations))
+                .view());
+
+        logger.info("site: count bytes loop");
+        for (const auto &site: _sites) {
+            if (site.address == nullptr) { continue; }
+
+            logger.info(
+                kf::memory::ArrayString<64>::formatted(
+                    "%p: %lu %lu %lu",
+                    site.address,
+                    static_cast<unsigned long>(site.count),
+                    static_cast<unsigned long>(site.bytes),
+                    static_cast<unsigned long>(site.loop_count))
+                    .view());
+        }
+
+        _armed.store(armed, std::memory_order_release);
+    }
+
+private:
+    static constexpr auto logger{kf::Logger::create("AllocationTracer")};
+
+    kf::memory::Array<Site, sites_total> _sites{};
+    kf::u32 _allocations{0}, _loop_allocations{0};
+    std::atomic<kf::u32> _frees{0}, _untracked{0};
+
+    std::atomic_flag _lock = ATOMIC_FLAG_INIT;
+    std::atomic<bool> _armed{false};
+    const void *_loop_task{nullptr};
+    std::atomic<const void *> _control_task{nullptr};
+
+    [[nodiscard]] static const void *currentTask() noexcept {
+#if defined(ARDUINO)
+        return xTaskGetCurrentTaskHandle();
+#else
+        static thread_local char marker;
+        return &marker;
+#endif
+    }
+
+    /// @return nullptr if the table is full
+    [[nodiscard]] Site *siteOf(const void *address) noexcept {
+        auto index = static_cast<kf::u16>((reinterpret_cast<kf::usize>(address) >> 2) & (sites_total - 1));
+
+        for (kf::u16 probe = 0; probe < sites_total; probe += 1) {
+            auto &site = _sites[index];
+            if (site.address == address) { return &site; }
+
+            if (site.address == nullptr) {
+                site.address = address;
+                return &site;
+            }
+
+            index = static_cast<kf::u16>((index + 1) & (sites_total - 1));
+        }
+
+        return nullptr;
+    }
+
+    [[noreturn]] void violation(const void *site, kf::usize size) noexcept {
+        _armed.store(false, std::memory_order_release);// reporting may allocate
+
+        logger.error(
+            kf::memory::ArrayString<80>::formatted(
+                "loop allocated %lu B at %p",
+                static_cast<unsigned long>(size),
+                site)
+                .view());
+
+        std::abort();
+    }
+};
+
+}// namespace djc::diagnostics
@@ -0,0 +1,251 @@
+// Copyright (c) 2026 KiraFlux
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#pragma once
+
+#include <kf/Logger.hpp>
+#include <kf/aliases.hpp>
+#include <kf/memory/ArrayString.hpp>
+
+#include "djc/diagnostics/Cycles.hpp"
+#include "djc/memory/FlatMap.hpp"
+#include "djc/memory/MacMap.hpp"
+#include "djc/memory/Pool.hpp"
+#include "djc/memory/Ring.hpp"
+#include "djc/prelude.hpp"
+
+namespace djc::diagnostics {
+
+namespace internal {
+
+// Constant expression use: built and queried by the compiler
+constexpr auto constexprFlatMap() noexcept {
+    auto map = memory::FlatMap<kf::u8, kf::u16, 4>::defaults();
+    (void) map.insert(30, 300);
+    (void) map.insert(10, 100);
+    (void) map.insert(20, 200);
+    (void) map.erase(10);
+    return map;
+}
+
+static_assert(constexprFlatMap().size() == 2);
+static_assert(constexprFlatMap().keyAt(0) == 20 and constexprFlatMap().keyAt(1) == 30);
+static_assert(*constexprFlatMap().find(30) == 300);
+
+constexpr auto constexprMacMap() noexcept {
+    auto map = memory::MacMap<kf::u8, 8>::defaults();
+    (void) map.insert({1, 2, 3, 4, 5, 6}, 1);
+    (void) map.insert({6, 5, 4, 3, 2, 1}, 2);
+    (void) map.erase({1, 2, 3, 4, 5, 6});
+    return map;
+}
+
+static_assert(constexprMacMap().size() == 1);
+static_assert(constexprMacMap().contains({6, 5, 4, 3, 2, 1}) and not constexprMacMap().contains({1, 2, 3, 4, 5, 6}));
+
+static_assert(memory::Ring<kf::u8, 8>::capacity() == 7);
+static_assert(memory::Pool<kf::u32, 5>::capacity() == 5);
+
+}// namespace internal
+
+/// @brief Exercises the djc::memory containers and times their lookups
+/// @details Covers insert, erase with backward shift, wrap-around and full-capacity rejection at run time; constant
+/// expression use is checked at compile time above. Runs on the device with `-D DJC_CONTAINER_CHECK`
+struct ContainerCheck final {
+
+    /// @return Every check passed
+    static bool run() noexcept {
+        bool passed{true};
+        passed &= flatMap();
+        passed &= macMap();
+        passed &= ring();
+        passed &= pool();
+        benchmark();
+
+        logger.info(passed ? "passed" : "FAILED");
+        return passed;
+    }
+
+private:
+    static constexpr auto logger{kf::Logger::create("ContainerCheck")};
+
+    static bool flatMap() noexcept {
+        using Map = memory::FlatMap<kf::u16, kf::u16, 8>;
+        auto map = Map::defaults();
+
+        bool passed{true};
+
+        // Reverse order: every insert shifts the whole tail
+        for (kf::u16 key = 8; key > 0; key -= 1) { (void) map.insert(key * 10, key); }
+        bool sorted{true};
+        for (kf::u16 i = 1; i < map.size(); i += 1) { sorted &= map.keyAt(i - 1) < map.keyAt(i); }
+        passed &= check("flat map sorted on insert", sorted and map.size() == 8);
+
+        passed &= check("flat map full rejects new key", map.insert(5, 0) == nullptr and map.size() == 8);
+        passed &= check("flat map full overwrites", map.insert(40, 44) != nullptr and *map.find(40) == 44);
+
+        passed &= check("flat map erase", map.erase(10) and not map.contains(10) and map.size() == 7);
+        passed &= check("flat map erase shifts back", map.keyAt(0) == 20 and *map.find(80) == 8);
+        passed &= check("flat map erase absent", not map.erase(10));
+        passed &= check("flat map insert after erase", map.insert(5, 5) != nullptr and map.keyAt(0) == 5);
+
+        return passed;
+    }
+
+    static bool macMap() noexcept {
+        using Map = memory::MacMap<kf::u16, 16>;
+        auto map = Map::defaults();
+
+        // Addresses sharing a home bucket form one probe run
+        EspNow::Mac run[4]{};
+        kf::u8 found{0};
+        kf::u16 home{0xFFFF};
+        for (kf::u16 n = 0; n < 0x1000 and found < 4; n += 1) {
+            const EspNow::Mac mac{0x02, 0, 0, 0, static_cast<kf::u8>(n >> 8), static_cast<kf::u8>(n)};
+            auto probe = Map::defaults();
+            (void) probe.insert(mac, 0);
+
+            const auto bucket = bucketOf(probe);
+            if (home == 0xFFFF) { home = bucket; }
+            if (bucket == home) { run[found++] = mac; }
+        }
+
+        bool passed{check("mac map collisions found", found == 4)};
+
+        for (kf::u8 i = 0; i < 4; i += 1) { (void) map.insert(run[i], i); }
+        passed &= check("mac map colliding insert", map.size() == 4);
+
+        // Erasing the head of the run must move the others back, or they become unreachable
+        passed &= check("mac map erase", map.erase(run[0]) and not map.contains(run[0]));
+        bool reachable{true};
+        for (kf::u8 i = 1; i < 4; i += 1) { reachable &= map.find(run[i]) != nullptr and *map.find(run[i]) == i; }
+        passed &= check("mac map erase shifts back", reachable);
+        passed &= check("mac map no tombstone", used(map) == map.size());
+
+        map.clear();
+        for (kf::u16 n = 0; n < Map::capacity(); n += 1) { (void) map.insert({0x02, 1, 1, 1, 0, static_cast<kf::u8>(n)}, n); }
+        passed &= check("mac map fills to capacity", map.size() == Map::capacity());
+        passed &= check("mac map full rejects new key", map.insert({0x02, 9, 9, 9, 9, 9}, 0) == nullptr);
+        passed &= check("mac map full overwrites", map.insert({0x02, 1, 1, 1, 0, 0}, 77) != nullptr and *map.find({0x02, 1, 1, 1, 0, 0}) == 77);
+
+        return passed;
+    }
+
+    static bool ring() noexcept {
+        memory::Ring<kf::u16, 8> ring{};
+
+        bool passed{true};
+
+        kf::u16 value{0};
+        for (kf::u16 i = 0; i < decltype(ring)::capacity(); i += 1) { (void) ring.push(i); }
+        passed &= check("ring full rejects", not ring.push(99) and ring.dropped() == 1 and ring.size() == 7);
+
+        // Indices wrap several times, order is kept
+        bool ordered{true};
+        kf::u16 expected{0}, next{7};
+        for (kf::u16 round = 0; round < 40; round += 1) {
+            ordered &= ring.pop(value) and value == expected;
+            expected += 1;
+            ordered &= ring.push(next);
+            next += 1;
+        }
+        passed &= check("ring wrap-around keeps order", ordered and ring.size() == 7);
+
+        while (ring.pop(value)) {}
+        passed &= check("ring empty after drain", ring.empty() and not ring.pop(value));
+
+        return passed;
+    }
+
+    static bool pool() noexcept {
+        struct Item {
+            kf::u32 value;
+        };
+
+        memory::Pool<Item, 4> pool{};
+        Item *items[4]{};
+
+        bool passed{true};
+
+        for (auto &item: items) { item = pool.create(Item{7}); }
+        passed &= check("pool fills", pool.full() and pool.size() == 4 and items[3] != nullptr and items[3]->value == 7);
+        passed &= check("pool full rejects", pool.create(Item{0}) == nullptr);
+
+        // A freed slot is reused first, at the same index
+        const auto index = pool.indexOf(items[1]);
+        pool.destroy(items[1]);
+        passed &= check("pool destroy", pool.size() == 3 and pool.at(index) == nullptr);
+
+        auto *reused = pool.create(Item{9});
+        passed &= check("pool reuses slot", reused != nullptr and pool.indexOf(reused) == index and pool.at(index)->value == 9);
+
+        pool.destroy(reused);
+        pool.destroy(reused);// twice: ignored
+        passed &= check("pool double destroy ignored", pool.size() == 3);
+
+        return passed;
+    }
+
+    /// @brief Lookup cost for a peer-table sized set (24 entries), cycles per find
+    static void benchmark() noexcept {
+        static constexpr kf::u16 entries{24};
+        static constexpr kf::u16 rounds{64};
+
+        auto flat = memory::FlatMap<kf::u32, kf::u16, 32>::defaults();
+        auto hashed = memory::MacMap<kf::u16, 32>::defaults();
+
+        for (kf::u16 i = 0; i < entries; i += 1) {
+            (void) flat.insert(macKey(mac(i)), i);
+            (void) hashed.insert(mac(i), i);
+        }
+
+        volatile kf::u32 sink{0};
+
+        auto start = cycles();
+        for (kf::u16 r = 0; r < rounds; r += 1) {
+            for (kf::u16 i = 0; i < entries; i += 1) { sink = sink + *flat.find(macKey(mac(i))); }
+        }
+        const auto flat_cycles = (cycles() - start) / (rounds * entries);
+
+        start = cycles();
+        for (kf::u16 r = 0; r < rounds; r += 1) {
+            for (kf::u16 i = 0; i < entries; i += 1) { sink = sink + *hashed.find(mac(i)); }
+        }
+        const auto hashed_cycles = (cycles() - start) / (rounds * entries);
+
+        logger.info(
+            kf::memory::ArrayString<64>::formatted(
+                "find, %u entries: flat %lu, mac %lu cycles",
+                static_cast<unsigned>(entries),
+                static_cast<unsigned long>(flat_cycles),
+                static_cast<unsigned long>(hashed_cycles))
+                .view());
+    }
+
+    static constexpr EspNow::Mac mac(kf::u16 n) noexcept { return {0x02, 0x10, 0x20, 0x30, static_cast<kf::u8>(n * 37), static_cast<kf::u8>(n)}; }
+
+    /// @brief Last four bytes as a sortable key
+    static constexpr kf::u32 macKey(const EspNow::Mac &mac) noexcept {
+        return (static_cast<kf::u32>(mac[2]) << 24) | (static_cast<kf::u32>(mac[3]) << 16) | (static_cast<kf::u32>(mac[4]) << 8) | mac[5];
+    }
+
+    template<typename Map> static kf::u16 bucketOf(const Map &map) noexcept {
+        for (kf::u16 i = 0; i < map.used.size(); i += 1) {
+            if (map.used[i]) { return i; }
+        }
+        return 0xFFFF;
+    }
+
+    template<typename Map> static kf::u16 used(const Map &map) noexcept {
+        kf::u16 total{0};
+        for (const auto bucket: map.used) { total += bucket ? 1 : 0; }
+        return total;
+    }
+
+    static bool check(const char *name, bool ok) noexcept {
+        if (not ok) { logger.error(kf::memory::ArrayString<48>::formatted("%s: failed", name).view()); }
+        return ok;
+    }
+};
+
+}// namespace djc::diagnostics
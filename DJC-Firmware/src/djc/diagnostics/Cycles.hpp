@@ -0,0 +1,36 @@
+// Copyright (c) 2026 KiraFlux
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#pragma once
+
+#if defined(ARDUINO)
+#include <Arduino.h>// for ESP.getCycleCount
+#else
+#include <chrono>
+#endif
+
+#include <kf/aliases.hpp>
+
+namespace djc::diagnostics {
+
+using Cycles = kf::u32;
+
+/// @brief Free-running CPU cycle counter (wraps, use differences only)
+inline Cycles cycles() noexcept {
+#if defined(ARDUINO)
+    return ESP.getCycleCount();
+#else
+    return static_cast<Cycles>(std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count());
+#endif
+}
+
+/// @brief Cycle counter frequency
+inline kf::u32 cyclesPerMicrosecond() noexcept {
+#if defined(ARDUINO)
+    return ESP.getCpuFreqMHz();
+#else
+    return 1000;// nanosecond counter
+#endif
+}
+
+}// namespace djc::diagnostics
@@ -0,0 +1,87 @@
+// Copyright (c) 2026 KiraFlux
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#pragma once
+
+#include <kf/Logger.hpp>
+#include <kf/aliases.hpp>
+#include <kf/math/units.hpp>
+#include <kf/memory/ArrayString.hpp>
+#include <kf/mixin/Singleton.hpp>
+
+namespace djc::diagnostics {
+
+/// @brief Dumps one rendered frame to the log as hex rows (see tools/frame.py)
+/// @details Lines: "capture <width> <height>", "F <row hex>" per pixel row, "end <render us> <SPI bytes> <transfer us>"
+struct FrameCapture final : kf::mixin::Singleton<FrameCapture> {
+
+    static constexpr kf::math::Pixels max_width{160};
+
+    /// @brief Capture the next rendered frame
+    void request() noexcept {
+        if (_state == State::Idle) { _state = State::Requested; }
+    }
+
+    /// @brief Start capture of the frame being rendered, if requested
+    /// @return Rows of this frame must be passed to rows()
+    bool begin(kf::math::Pixels width, kf::math::Pixels height) noexcept {
+        if (_state != State::Requested) { return false; }
+        _state = State::Capturing;
+
+        logger.info(kf::memory::ArrayString<32>::formatted("capture %u %u", static_cast<unsigned>(width), static_cast<unsigned>(height)).view());
+        return true;
+    }
+
+    [[nodiscard]] bool capturing() const noexcept { return _state == State::Capturing; }
+
+    /// @param first First pixel of the first row, raw bytes are dumped in memory (display) order
+    template<typename P> void rows(const P *first, kf::math::Pixels stride, kf::math::Pixels width, kf::math::Pixels count) noexcept {
+        static constexpr char hex[] = "0123456789abcdef";
+
+        if (width > max_width) { width = max_width; }
+        const auto bytes = static_cast<kf::usize>(width) * sizeof(P);
+
+        for (kf::math::Pixels row = 0; row < count; row += 1) {
+            const auto *data = reinterpret_cast<const kf::u8 *>(first + row * stride);
+
+            char text[max_width * sizeof(P) * 2 + 1];
+            for (kf::usize i = 0; i < bytes; i += 1) {
+                text[i * 2 + 0] = hex[data[i] >> 4];
+                text[i * 2 + 1] = hex[data[i] & 0x0F];
+            }
+            text[bytes * 2] = '\0';
+
+            (void) _line.format("F %s", text);
+            logger.info(_line.view());
+        }
+    }
+
+    /// @brief Finish capture with the frame cost
+    /// @param transfer_us Transfer time not included in render_us (0 in strip mode, where both are interleaved)
+    void end(kf::u32 render_us, kf::u32 bytes, kf::u32 transfer_us) noexcept {
+        if (_state != State::Capturing) { return; }
+        _state = State::Idle;
+
+        logger.info(
+            kf::memory::ArrayString<48>::formatted(
+                "end %lu %lu %lu",
+                static_cast<unsigned long>(render_us),
+                static_cast<unsigned long>(bytes),
+                static_cast<unsigned long>(transfer_us))
+                .view());
+    }
+
+private:
+    static constexpr auto logger{kf::Logger::create("Capture")};
+
+    enum class State : kf::u8 {
+        Idle,
+        Requested,
+        Capturing,
+    };
+
+    State _state{State::Idle};
+    kf::memory::ArrayString<max_width * 4 + 4> _line{};
+};
+
+}// namespace djc::diagnostics
@@ -0,0 +1,60 @@
+// Copyright (c) 2026 KiraFlux
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#pragma once
+
+#include <kf/aliases.hpp>
+#include <kf/memory/Array.hpp>
+
+namespace djc::diagnostics {
+
+/// @brief Fixed-size histogram with power-of-two buckets
+/// @details Bucket 0 holds zero, bucket i holds [2^(i-1); 2^i), the last bucket is open-ended
+template<kf::u8 N> struct Histogram {
+    static_assert(N >= 2 and N <= 32, "Histogram bucket count out of range");
+
+    kf::memory::Array<kf::u32, N> buckets;
+    kf::u32 count, max;
+
+    static constexpr kf::u8 bucketsTotal() noexcept { return N; }
+
+    void add(kf::u32 value) noexcept {
+        count += 1;
+        if (value > max) { max = value; }
+
+        kf::u8 index{0};
+        while (value > 0 and index < N - 1) {
+            value >>= 1;
+            index += 1;
+        }
+
+        buckets[index] += 1;
+    }
+
+    /// @brief Upper bound of the bucket containing given percentile
+    [[nodiscard]] kf::u32 percentile(kf::u8 percent) const noexcept {
+        if (count == 0) { return 0; }
+
+        const auto target = (static_cast<kf::u64>(count) * percent + 99) / 100;
+        kf::u64 accumulated{0};
+
+        for (kf::u8 i = 0; i < N - 1; i += 1) {
+            accumulated += buckets[i];
+            if (accumulated >= target) { return (i == 0) ? 0 : (kf::u32{1} << i) - 1; }
+        }
+
+        return max;
+    }
+
+    void reset() noexcept { *this = defaults(); }
+
+    static constexpr Histogram defaults() noexcept {
+        return Histogram{
+            .buckets = {},
+            .count = 0,
+            .max = 0,
+        };
+    }
+};
+
+}// namespace djc::diagnostics
@@ -0,0 +1,102 @@
+// Copyright (c) 2026 KiraFlux
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#pragma once
+
+#include <kf/Logger.hpp>
+#include <kf/aliases.hpp>
+#include <kf/memory/Array.hpp>
+#include <kf/memory/ArrayString.hpp>
+#include <kf/memory/StringView.hpp>
+#include <kf/mixin/Singleton.hpp>
+
+#include "djc/diagnostics/Cycles.hpp"
+#include "djc/diagnostics/Histogram.hpp"
+
+/// Input-to-air latency probes. Enabled with `-D DJC_LATENCY_TRACE`, otherwise expands to nothing
+#if defined(DJC_LATENCY_TRACE)
+#define DJC_LATENCY_MARK(stage) ::djc::diagnostics::LatencyTracer::instance().mark(::djc::diagnostics::LatencyTracer::Stage::stage)
+#else
+#define DJC_LATENCY_MARK(stage) ((void) 0)
+#endif
+
+namespace djc::diagnostics {
+
+/// @brief Records per-stage latency of the input-to-air path, relative to the ADC sample of the same tick
+struct LatencyTracer final : kf::mixin::Singleton<LatencyTracer> {
+
+    enum class Stage : kf::u8 {
+        AdcSample,   // Tick sample started
+        FilterOutput,// All axes read and filtered
+        ControlInput,// Control::input() accepted the frame
+        Encode,      // Outgoing control packet serialized
+        Send,        // Packet handed over to ESP-NOW
+    };
+
+    static constexpr kf::u8 stages_total{5};
+
+    using LatencyHistogram = Histogram<16>;// microseconds: closed buckets up to ~16 ms (2^14 us), the last one takes the rest
+
+    [[nodiscard]] static constexpr kf::memory::StringView stringFromStage(Stage stage) noexcept {
+        constexpr kf::memory::StringView names[stages_total] = {"ADC", "Filt", "Ctrl", "Enc", "Send"};
+        return names[static_cast<kf::u8>(stage)];
+    }
+
+    [[nodiscard]] const LatencyHistogram &histogram(Stage stage) const noexcept { return _histograms[static_cast<kf::u8>(stage)]; }
+
+    /// @brief Timestamp a stage. AdcSample opens a new trace, other stages are recorded once per trace
+    void mark(Stage stage) noexcept {
+        const auto now = cycles();
+
+        if (stage == Stage::AdcSample) {
+            _origin = now;
+            _marked = 1;
+            return;
+        }
+
+        const auto bit = static_cast<kf::u8>(1u << static_cast<kf::u8>(stage));
+        if (_marked == 0 or (_marked & bit) != 0) { return; }
+        _marked |= bit;
+
+        _histograms[static_cast<kf::u8>(stage)].add((now - _origin) / cyclesPerMicrosecond());
+    }
+
+    void reset() noexcept {
+        for (auto &h: _histograms) { h.reset(); }
+        _marked = 0;
+    }
+
+    /// @brief Write summary of every stage to the log (serial)
+    void dump() const noexcept {
+        logger.info("stage: count p50 p99 max [us]");
+
+        for (kf::u8 i = 1; i < stages_total; i += 1) {
+            const auto &h = _histograms[i];
+            logger.info(
+                kf::memory::ArrayString<64>::formatted(
+                    "%s: %lu %lu %lu %lu",
+                    stringFromStage(static_cast<Stage>(i)).data(),
+                    static_cast<unsigned long>(h.count),
+                    static_cast<unsigned long>(h.percentile(50)),
+                    static_cast<unsigned long>(h.percentile(99)),
+                    static_cast<unsigned long>(h.max))
+                    .view());
+        }
+    }
+
+private:
+    static constexpr auto logger{kf::Logger::create("Latency")};
+
+    kf::memory::Array<LatencyHistogram, stages_total> _histograms{{
+        LatencyHistogram::defaults(),
+        LatencyHistogram::defaults(),
+        LatencyHistogram::defaults(),
+        LatencyHistogram::defaults(),
+        LatencyHistogram::defaults(),
+    }};
+
+    Cycles _origin{0};
+    kf::u8 _marked{0};// bit per stage recorded in current trace
+};
+
+}// namespace djc::diagnostics
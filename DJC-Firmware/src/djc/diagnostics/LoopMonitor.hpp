@@ -0,0 +1,112 @@
+// Copyright (c) 2026 KiraFlux
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#pragma once
+
+#if defined(ARDUINO)
+#include <Arduino.h>// for ESP, uxTaskGetStackHighWaterMark
+#endif
+
+#include <kf/Logger.hpp>
+#include <kf/aliases.hpp>
+#include <kf/math/units.hpp>
+#include <kf/memory/ArrayString.hpp>
+#include <kf/mixin/NonCopyable.hpp>
+
+#include "djc/diagnostics/Cycles.hpp"
+#include "djc/diagnostics/Histogram.hpp"
+
+namespace djc::diagnostics {
+
+/// @brief Main loop health: schedule drift, tick work time, missed deadlines and memory high-water marks
+struct LoopMonitor final : kf::mixin::NonCopyable {
+    using WorkHistogram = Histogram<16>;// microseconds
+
+    explicit LoopMonitor(kf::math::Milliseconds period) noexcept :
+        _period{period} {}
+
+    /// @brief Tick started at given (clock) time
+    void begin(kf::math::Milliseconds now) noexcept {
+        if (_ticks == 0) { _origin = now; }
+
+        const auto expected = _origin + _ticks * _period;
+        const auto drift = static_cast<kf::i32>(now - expected);
+        if (drift > _max_drift) { _max_drift = drift; }
+        if (drift >= static_cast<kf::i32>(_period)) { _late += 1; }
+        _drift = drift;
+
+        _ticks += 1;
+        _begin = cycles();
+    }
+
+    /// @brief Tick finished
+    /// @note Missed counts ticks whose CPU work exceeded the period, late counts ticks started a period or more behind
+    void end() noexcept {
+        const auto work = (cycles() - _begin) / cyclesPerMicrosecond();
+        _work.add(work);
+
+        if (work > _period * 1000) { _missed += 1; }
+
+        sampleMemory();
+    }
+
+    [[nodiscard]] kf::u32 ticks() const noexcept { return _ticks; }
+
+    [[nodiscard]] kf::u32 missed() const noexcept { return _missed; }
+
+    [[nodiscard]] kf::u32 late() const noexcept { return _late; }
+
+    void report() const noexcept {
+        logger.info(
+            kf::memory::ArrayString<96>::formatted(
+                "ticks %lu missed %lu late %lu drift %ld (max %ld) ms",
+                static_cast<unsigned long>(_ticks),
+                static_cast<unsigned long>(_missed),
+                static_cast<unsigned long>(_late),
+                static_cast<long>(_drift),
+                static_cast<long>(_max_drift))
+                .view());
+
+        logger.info(
+            kf::memory::ArrayString<96>::formatted(
+                "work p50 %lu p99 %lu max %lu us",
+                static_cast<unsigned long>(_work.percentile(50)),
+                static_cast<unsigned long>(_work.percentile(99)),
+                static_cast<unsigned long>(_work.max))
+                .view());
+
+        logger.info(
+            kf::memory::ArrayString<96>::formatted(
+                "heap min free %lu B, loop stack min free %lu B",
+                static_cast<unsigned long>(_min_free_heap),
+                static_cast<unsigned long>(_min_free_stack))
+                .view());
+    }
+
+private:
+    static constexpr auto logger{kf::Logger::create("LoopMonitor")};
+
+    const kf::math::Milliseconds _period;
+
+    kf::math::Milliseconds _origin{0};
+    kf::u32 _ticks{0}, _missed{0}, _late{0};
+    kf::i32 _drift{0}, _max_drift{0};
+    Cycles _begin{0};
+    WorkHistogram _work{WorkHistogram::defaults()};
+
+    kf::u32 _min_free_heap{0xFFFFFFFF};
+    kf::u32 _min_free_stack{0xFFFFFFFF};
+
+    void sampleMemory() noexcept {
+#if defined(ARDUINO)
+        const kf::u32 heap = ESP.getMinFreeHeap();
+        const kf::u32 stack = uxTaskGetStackHighWaterMark(nullptr);
+#else
+        const kf::u32 heap = 0, stack = 0;
+#endif
+        if (heap < _min_free_heap) { _min_free_heap = heap; }
+        if (stack < _min_free_stack) { _min_free_stack = stack; }
+    }
+};
+
+}// namespace djc::diagnostics
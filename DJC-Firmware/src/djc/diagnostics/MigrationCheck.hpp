@@ -0,0 +1,75 @@
+// Copyright (c) 2026 KiraFlux
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#pragma once
+
+#include <cstring>
+
+#include <kf/Logger.hpp>
+#include <kf/aliases.hpp>
+#include <kf/memory/Array.hpp>
+#include <kf/memory/ArrayString.hpp>
+
+#include "djc/Config.hpp"
+#include "djc/ConfigManager.hpp"
+#include "djc/ConfigMigrations.hpp"
+
+namespace djc::diagnostics {
+
+/// @brief Feeds a version 4 "DC" legacy blob through the import path and checks what a tuned device must keep
+/// @details Runs on the device, on RAM copies only: NVS is not touched. Enabled with `-D DJC_MIGRATION_CHECK`
+struct MigrationCheck final {
+
+    /// @return Every check passed
+    static bool run() noexcept {
+        static constexpr kf::u8 calibration_pattern{0x5A};
+
+        // As earlier firmware stored it: calibrated sticks, two favorites, renamed device
+        auto legacy = djc::internal::LegacyConfig::defaults();
+        legacy.version = djc::internal::LegacyConfig::last_version;
+        std::memset(&legacy.periphery.left_joystick, calibration_pattern, sizeof(legacy.periphery.left_joystick));
+        std::memset(&legacy.periphery.right_joystick, calibration_pattern + 1, sizeof(legacy.periphery.right_joystick));
+        legacy.periphery.joystick_axes_tune_samples = 321;
+        legacy.periphery.joystick_axes_tuned = true;
+        (void) legacy.peer_favorites.add({{0x02, 0x11, 0x22, 0x33, 0x44, 0x55}, {"bench"}});
+        (void) legacy.peer_favorites.add({{0x02, 0x66, 0x77, 0x88, 0x99, 0xAA}, {"field"}});
+        legacy.device_name = {"DJC-OLD"};
+
+        // The blob comes from NVS as bytes
+        kf::memory::Array<kf::u8, sizeof(djc::internal::LegacyConfig)> blob{};
+        std::memcpy(blob.data(), &legacy, sizeof(legacy));
+
+        auto stored = djc::internal::LegacyConfig::defaults();
+        std::memcpy(&stored, blob.data(), blob.size());
+
+        auto config = Config::defaults();
+        const auto profiles = config.peer_profiles;
+
+        bool passed{true};
+        passed &= check("version accepted", ConfigManager::importLegacy(stored, config));
+        passed &= check("left stick calibration", same(config.periphery.left_joystick, legacy.periphery.left_joystick));
+        passed &= check("right stick calibration", same(config.periphery.right_joystick, legacy.periphery.right_joystick));
+        passed &= check("tuned flag", config.periphery.joystick_axes_tuned and config.periphery.joystick_axes_tune_samples == 321);
+        passed &= check("favorites", same(config.peer_favorites.items, legacy.peer_favorites.items) and config.peer_favorites.size() == 2);
+        passed &= check("device name", same(config.device_name, legacy.device_name));
+        passed &= check("profiles untouched", same(config.peer_profiles, profiles));
+
+        stored.version = djc::internal::LegacyConfig::last_version + 1;
+        passed &= check("unknown version refused", not ConfigManager::importLegacy(stored, config));
+
+        logger.info(passed ? "passed" : "FAILED");
+        return passed;
+    }
+
+private:
+    static constexpr auto logger{kf::Logger::create("MigrationCheck")};
+
+    template<typename T> static bool same(const T &a, const T &b) noexcept { return std::memcmp(&a, &b, sizeof(T)) == 0; }
+
+    static bool check(const char *name, bool ok) noexcept {
+        if (not ok) { logger.error(kf::memory::ArrayString<48>::formatted("%s: failed", name).view()); }
+        return ok;
+    }
+};
+
+}// namespace djc::diagnostics
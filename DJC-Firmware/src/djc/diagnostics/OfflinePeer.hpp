@@ -0,0 +1,44 @@
+// Copyright (c) 2026 KiraFlux
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#pragma once
+
+#include <kf/aliases.hpp>
+#include <kf/memory/Slice.hpp>
+
+#include "djc/prelude.hpp"
+
+// Session replay and soak runs feed recorded or scripted traffic: the radio must stay off
+#if (defined(DJC_SESSION_REPLAY) or defined(DJC_SOAK_TEST)) and not defined(DJC_OFFLINE_RADIO)
+#define DJC_OFFLINE_RADIO
+#endif
+
+namespace djc::diagnostics {
+
+/// @brief Stand-in for an ESP-NOW peer when the radio is off: connects to nothing, drops every packet
+/// @note Only the part of EspNow::Peer used by Control. Sent packets are still recorded and counted by their callers
+struct OfflinePeer final {
+    /// @brief Attachment result, never an error
+    struct Attached {
+        [[nodiscard]] static constexpr bool isError() noexcept { return false; }
+    };
+
+    explicit OfflinePeer(const EspNow::Mac &mac) noexcept :
+        _mac{mac} {}
+
+    [[nodiscard]] const EspNow::Mac &mac() const noexcept { return _mac; }
+
+    [[nodiscard]] static constexpr bool exist() noexcept { return true; }
+
+    /// @brief Nothing arrives over the air: replayed traffic enters through Control::receive
+    template<typename F> [[nodiscard]] static Attached onReceive(F &&) noexcept { return {}; }
+
+    static bool writeBuffer(kf::memory::Slice<const kf::u8>) noexcept { return true; }
+
+    template<typename T> static bool writePacket(const T &) noexcept { return true; }
+
+private:
+    EspNow::Mac _mac;
+};
+
+}// namespace djc::diagnostics
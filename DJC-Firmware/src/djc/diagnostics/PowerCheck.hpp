@@ -0,0 +1,131 @@
+// Copyright (c) 2026 KiraFlux
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#pragma once
+
+#include <kf/Logger.hpp>
+#include <kf/aliases.hpp>
+#include <kf/math/units.hpp>
+#include <kf/memory/ArrayString.hpp>
+#include <kf/mixin/NonCopyable.hpp>
+
+#include "djc/Clock.hpp"
+#include "djc/Control.hpp"
+#include "djc/PowerManager.hpp"
+#include "djc/input/InputFrame.hpp"
+
+namespace djc::diagnostics {
+
+/// @brief Light sleep stand-in: lets virtual time pass instead of sleeping
+struct SimulatedSleep final : SleepBackend {
+    static constexpr kf::math::Milliseconds duration{30'000};
+
+    [[nodiscard]] kf::u32 sleeps() const noexcept { return _sleeps; }
+
+    bool lightSleep() noexcept override {
+        _sleeps += 1;
+        Clock::sleep(duration);
+        return true;
+    }
+
+private:
+    kf::u32 _sleeps{0};
+};
+
+/// @brief Drives PowerManager through its states under the virtual clock, with light sleep simulated
+/// @details Cases: idle through Dimmed and Slow into light sleep and back; input arriving after Sleep is entered but
+/// before Control executed the suspend, which must cancel the sleep and resume only once Control acknowledged both.
+/// Enabled with `-D DJC_POWER_CHECK`
+struct PowerCheck final : kf::mixin::NonCopyable {
+    /// @brief Every service of the main loop for one input frame (main.cpp tick)
+    using Tick = void (*)(const input::InputFrame &);
+
+    explicit PowerCheck(PowerManager &power_manager, Control &control, SimulatedSleep &sleep_backend, Tick tick) noexcept :
+        _power{power_manager}, _control{control}, _sleep{sleep_backend}, _tick{tick} {}
+
+    /// @return Every check passed
+    bool run() noexcept {
+        using State = PowerManager::State;
+
+        const auto &config = _power.config();
+        _power.onStateChange([this](State state) { _visited |= 1u << static_cast<kf::u8>(state); });
+
+        bool passed{true};
+
+        // Idle into light sleep and back
+        passed &= check("reached sleep", idleUntil(State::Sleep, config.sleep_timeout + 1000));
+        passed &= check("dimmed and slow on the way", (_visited & mask(State::Dimmed)) != 0 and (_visited & mask(State::Slow)) != 0);
+        passed &= check("slept", stepUntil([this]() { return _sleep.sleeps() == 1; }, 5000));
+        passed &= check("woke active", _power.state() == State::Active);
+        passed &= check("resumed", stepUntil([this]() { return _power.stats().resumes == 1; }, 5000));
+        passed &= check("radio back", not _control.state().suspended);
+
+        // Input right after Sleep was entered, before Control ran the suspend
+        passed &= check("reached sleep again", idleUntil(State::Sleep, config.sleep_timeout + 1000));
+        step(true);
+        passed &= check("sleep cancelled", _power.state() == State::Active);
+        passed &= check("cancel resumed", stepUntil([this]() { return _power.stats().resumes == 2; }, 5000));
+        passed &= check("radio back after cancel", not _control.state().suspended);
+        passed &= check("no sleep after cancel", _sleep.sleeps() == 1);
+
+        _power.onStateChange(PowerManager::StateCallback{nullptr});
+
+        _power.report();
+        logger.info(passed ? "passed" : "FAILED");
+        return passed;
+    }
+
+private:
+    static constexpr auto logger{kf::Logger::create("PowerCheck")};
+
+    static constexpr kf::math::Milliseconds step_period{1000 / 50};
+
+    PowerManager &_power;
+    Control &_control;
+    SimulatedSleep &_sleep;
+    Tick _tick;
+    kf::u32 _visited{0};// state bits entered
+
+    static constexpr kf::u32 mask(PowerManager::State state) noexcept { return 1u << static_cast<kf::u8>(state); }
+
+    /// @brief One loop round: input, every service, power, then virtual time moves on
+    void step(bool active) noexcept {
+        const auto now = Clock::now();
+
+        const input::InputFrame frame{
+            .timestamp = now,
+            .left_joystick = {.x = active ? 1.0f : 0.0f, .y = 0},
+            .right_joystick = {.x = 0, .y = 0},
+            .left_button = {.pressed = false, .clicked = false},
+            .right_button = {.pressed = false, .clicked = false},
+        };
+
+        (void) _power.activity(frame);
+        _tick(frame);
+        _power.poll(now);
+        Clock::sleep(step_period);
+    }
+
+    /// @brief Step idle until the state is entered (stops right after, Control has not polled since)
+    bool idleUntil(PowerManager::State state, kf::math::Milliseconds timeout) noexcept {
+        return stepUntil([this, state]() { return _power.state() == state; }, timeout);
+    }
+
+    template<typename Condition> bool stepUntil(Condition condition, kf::math::Milliseconds timeout) noexcept {
+        const auto end = Clock::now() + timeout;
+
+        while (Clock::now() < end) {
+            step(false);
+            if (condition()) { return true; }
+        }
+
+        return false;
+    }
+
+    static bool check(const char *name, bool ok) noexcept {
+        if (not ok) { logger.error(kf::memory::ArrayString<48>::formatted("%s: failed", name).view()); }
+        return ok;
+    }
+};
+
+}// namespace djc::diagnostics
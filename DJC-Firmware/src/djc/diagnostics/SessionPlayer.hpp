@@ -0,0 +1,113 @@
+// Copyright (c) 2026 KiraFlux
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#pragma once
+
+#include <kf/aliases.hpp>
+#include <kf/math/units.hpp>
+#include <kf/memory/Slice.hpp>
+
+#include "djc/diagnostics/SessionRecorder.hpp"
+#include "djc/input/InputFrame.hpp"
+#include "djc/prelude.hpp"
+
+namespace djc::diagnostics {
+
+/// @brief Sequential reader of a dumped session (see SessionRecorder)
+struct SessionPlayer final {
+    using Kind = SessionRecord::Kind;
+
+    struct Record {
+        Kind kind;
+        kf::math::Milliseconds time;
+        kf::memory::Slice<const kf::u8> payload;
+    };
+
+    /// @param session Raw session bytes
+    /// @param start Absolute time of the first record (from the dump header)
+    explicit constexpr SessionPlayer(kf::memory::Slice<const kf::u8> session, kf::math::Milliseconds start) noexcept :
+        _session{session}, _time{start} {}
+
+    [[nodiscard]] bool finished() const noexcept { return _offset + SessionRecord::header_size > _session.size(); }
+
+    /// @brief Read next record
+    /// @return false at the end of the session or on a truncated record
+    [[nodiscard]] bool next(Record &record) noexcept {
+        while (not finished()) {
+            const auto kind = static_cast<Kind>(byte(0));
+            const auto delta = static_cast<kf::math::Milliseconds>(byte(1) | (byte(2) << 8));
+            const auto length = static_cast<kf::usize>(byte(3));
+
+            if (_offset + SessionRecord::header_size + length > _session.size()) { return false; }
+
+            const kf::memory::Slice<const kf::u8> payload{_session.data() + _offset + SessionRecord::header_size, length};
+            _offset += SessionRecord::header_size + length;
+
+            // First record time is given by the dump header
+            if (_started) { _time += delta; }
+            _started = true;
+
+            if (kind == Kind::Time) {
+                if (length == 4) {
+                    _time = static_cast<kf::math::Milliseconds>(payload[0] | (payload[1] << 8) | (payload[2] << 16) | (static_cast<kf::u32>(payload[3]) << 24));
+                }
+                continue;
+            }
+
+            record = Record{
+                .kind = kind,
+                .time = _time,
+                .payload = payload,
+            };
+            return true;
+        }
+
+        return false;
+    }
+
+    [[nodiscard]] static input::InputFrame frameFromRecord(const Record &record) noexcept {
+        const auto &p = record.payload;
+
+        const auto axis = [&p](kf::usize i) -> kf::f32 {
+            const auto raw = static_cast<kf::i16>(p[i * 2] | (p[i * 2 + 1] << 8));
+            return static_cast<kf::f32>(raw) / SessionRecord::axis_scale;
+        };
+
+        const auto flags = p[8];
+
+        return input::InputFrame{
+            .timestamp = record.time,
+            .left_joystick = {.x = axis(0), .y = axis(1)},
+            .right_joystick = {.x = axis(2), .y = axis(3)},
+            .left_button = {
+                .pressed = (flags & SessionRecord::LeftPressed) != 0,
+                .clicked = (flags & SessionRecord::LeftClicked) != 0,
+            },
+            .right_button = {
+                .pressed = (flags & SessionRecord::RightPressed) != 0,
+                .clicked = (flags & SessionRecord::RightClicked) != 0,
+            },
+        };
+    }
+
+    [[nodiscard]] static EspNow::Mac macFromRecord(const Record &record) noexcept {
+        EspNow::Mac mac{};
+        for (kf::usize i = 0; i < mac.size(); i += 1) { mac[i] = record.payload[i]; }
+        return mac;
+    }
+
+    [[nodiscard]] static kf::memory::Slice<const kf::u8> dataFromUnknownRecord(const Record &record) noexcept {
+        constexpr kf::usize mac_size{6};
+        return {record.payload.data() + mac_size, record.payload.size() - mac_size};
+    }
+
+private:
+    kf::memory::Slice<const kf::u8> _session;
+    kf::usize _offset{0};
+    kf::math::Milliseconds _time;
+    bool _started{false};
+
+    [[nodiscard]] kf::u8 byte(kf::usize i) const noexcept { return _session[_offset + i]; }
+};
+
+}// namespace djc::diagnostics
@@ -0,0 +1,260 @@
+// Copyright (c) 2026 KiraFlux
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#pragma once
+
+#if defined(ARDUINO)
+#include <Arduino.h>// for portMUX
+#endif
+
+#include <kf/Logger.hpp>
+#include <kf/aliases.hpp>
+#include <kf/math/units.hpp>
+#include <kf/memory/Array.hpp>
+#include <kf/memory/ArrayString.hpp>
+#include <kf/memory/Slice.hpp>
+#include <kf/mixin/Singleton.hpp>
+
+#include "djc/Clock.hpp"
+#include "djc/input/InputFrame.hpp"
+#include "djc/prelude.hpp"
+
+/// Session recording hooks. Enabled with `-D DJC_SESSION_RECORD`, otherwise expands to nothing
+#if defined(DJC_SESSION_RECORD)
+#define DJC_SESSION_RECORD_CALL(method, ...) ::djc::diagnostics::SessionRecorder::instance().method(__VA_ARGS__)
+#else
+#define DJC_SESSION_RECORD_CALL(method, ...) ((void) 0)
+#endif
+
+namespace djc::diagnostics {
+
+/// @brief Session record layout shared by recorder, player and tools/session.py
+/// @details Record: [kind : u8] [time delta : u16 LE, ms] [length : u8] [payload : length]
+struct SessionRecord {
+
+    enum class Kind : kf::u8 {
+        Time,          // payload: absolute time u32 LE (delta did not fit)
+        Frame,         // payload: 4 x i16 LE axes (x1000) + button flags u8
+        Button,        // payload: button index u8 + pressed u8
+        Receive,       // payload: ESP-NOW data from the active peer
+        ReceiveUnknown,// payload: MAC (6) + ESP-NOW data from an unknown peer
+        Send,          // payload: ESP-NOW data sent to the active peer
+    };
+
+    enum ButtonFlag : kf::u8 {
+        LeftPressed = 1 << 0,
+        LeftClicked = 1 << 1,
+        RightPressed = 1 << 2,
+        RightClicked = 1 << 3,
+    };
+
+    static constexpr kf::usize header_size{4};
+    static constexpr kf::usize frame_size{9};
+    static constexpr kf::usize max_payload{255};
+
+    static constexpr kf::f32 axis_scale{1000};
+};
+
+/// @brief Compact binary recorder of inputs and radio traffic since boot
+/// @note Recording stops once the buffer is full instead of evicting old records: replay starts from a fresh setup(),
+/// so a session is only reproducible when it is complete from boot (~10 s of input at 50 Hz, longer when idle)
+struct SessionRecorder final : kf::mixin::Singleton<SessionRecorder> {
+    using Kind = SessionRecord::Kind;
+
+    static constexpr kf::usize capacity{8 * 1024};
+
+    [[nodiscard]] kf::usize size() const noexcept { return _size; }
+
+    /// @brief Buffer ran out, records after that moment are not kept
+    [[nodiscard]] bool full() const noexcept { return _full; }
+
+    /// @brief Records refused since the buffer filled up
+    [[nodiscard]] kf::u32 dropped() const noexcept { return _dropped; }
+
+    void frame(const input::InputFrame &frame) noexcept {
+        const kf::i16 axes[4] = {
+            quantize(frame.left_joystick.x),
+            quantize(frame.left_joystick.y),
+            quantize(frame.right_joystick.x),
+            quantize(frame.right_joystick.y),
+        };
+
+        kf::u8 payload[SessionRecord::frame_size];
+        for (auto i = 0; i < 4; i += 1) {
+            payload[i * 2 + 0] = static_cast<kf::u8>(axes[i] & 0xFF);
+            payload[i * 2 + 1] = static_cast<kf::u8>((axes[i] >> 8) & 0xFF);
+        }
+
+        const auto flags = static_cast<kf::u8>(
+            (frame.left_button.pressed ? SessionRecord::LeftPressed : 0) |
+            (frame.left_button.clicked ? SessionRecord::LeftClicked : 0) |
+            (frame.right_button.pressed ? SessionRecord::RightPressed : 0) |
+            (frame.right_button.clicked ? SessionRecord::RightClicked : 0));
+        payload[8] = flags;
+
+        write(Kind::Frame, frame.timestamp, {payload, sizeof(payload)});
+
+        // Edges are recorded separately so they survive frame decimation in tools
+        const auto edges = static_cast<kf::u8>((flags ^ _last_flags) & (SessionRecord::LeftPressed | SessionRecord::RightPressed));
+        _last_flags = flags;
+
+        if (edges & SessionRecord::LeftPressed) { button(0, frame.left_button.pressed, frame.timestamp); }
+        if (edges & SessionRecord::RightPressed) { button(1, frame.right_button.pressed, frame.timestamp); }
+    }
+
+    void received(kf::memory::Slice<const kf::u8> data) noexcept {
+        write(Kind::Receive, Clock::now(), data);
+    }
+
+    void receivedFromUnknown(const EspNow::Mac &mac, kf::memory::Slice<const kf::u8> data) noexcept {
+        write(Kind::ReceiveUnknown, Clock::now(), data, {mac.data(), mac.size()});
+    }
+
+    void sent(kf::memory::Slice<const kf::u8> data) noexcept {
+        write(Kind::Send, Clock::now(), data);
+    }
+
+    void clear() noexcept {
+        lock();
+        _size = 0;
+        _dropped = 0;
+        _full = false;
+        unlock();
+    }
+
+    /// @brief Write buffered session to the log as hex lines (see tools/session.py)
+    /// @note Recording is paused while dumping
+    void dump() noexcept {
+        lock();
+        _paused = true;
+        const auto size = _size;
+        const auto start = _start_time;
+        const auto full = _full;
+        const auto dropped = _dropped;
+        unlock();
+
+        if (full) {
+            logger.error(kf::memory::ArrayString<64>::formatted("buffer filled up, %lu later records dropped", static_cast<unsigned long>(dropped)).view());
+        }
+
+        logger.info(kf::memory::ArrayString<48>::formatted("begin %lu %lu", static_cast<unsigned long>(start), static_cast<unsigned long>(size)).view());
+
+        static constexpr kf::usize bytes_per_line{32};
+        static constexpr char hex[] = "0123456789abcdef";
+
+        kf::memory::ArrayString<bytes_per_line * 2 + 4> line{};
+        for (kf::usize offset = 0; offset < size; offset += bytes_per_line) {
+            const auto n = (size - offset < bytes_per_line) ? size - offset : bytes_per_line;
+
+            char text[bytes_per_line * 2 + 1];
+            for (kf::usize i = 0; i < n; i += 1) {
+                const auto b = _buffer[offset + i];
+                text[i * 2 + 0] = hex[b >> 4];
+                text[i * 2 + 1] = hex[b & 0x0F];
+            }
+            text[n * 2] = '\0';
+
+            (void) line.format("S %s", text);
+            logger.info(line.view());
+        }
+
+        logger.info("end");
+
+        lock();
+        _paused = false;
+        unlock();
+    }
+
+private:
+    static constexpr auto logger{kf::Logger::create("Session")};
+
+    kf::memory::Array<kf::u8, capacity> _buffer{};
+    kf::usize _size{0};
+    kf::math::Milliseconds _head_time{0}; // time of the newest record
+    kf::math::Milliseconds _start_time{0};// time of the first record
+    kf::u32 _dropped{0};
+    kf::u8 _last_flags{0};
+    bool _full{false};
+    bool _paused{false};
+
+#if defined(ARDUINO)
+    portMUX_TYPE _mux = portMUX_INITIALIZER_UNLOCKED;// radio callbacks record from the Wi-Fi task
+
+    void lock() noexcept { portENTER_CRITICAL(&_mux); }
+
+    void unlock() noexcept { portEXIT_CRITICAL(&_mux); }
+#else
+    void lock() noexcept {}
+
+    void unlock() noexcept {}
+#endif
+
+    static kf::i16 quantize(kf::f32 value) noexcept { return static_cast<kf::i16>(value * SessionRecord::axis_scale); }
+
+    void button(kf::u8 index, bool pressed, kf::math::Milliseconds now) noexcept {
+        const kf::u8 payload[2] = {index, static_cast<kf::u8>(pressed)};
+        write(Kind::Button, now, {payload, sizeof(payload)});
+    }
+
+    void write(Kind kind, kf::math::Milliseconds now, kf::memory::Slice<const kf::u8> data, kf::memory::Slice<const kf::u8> prefix = {}) noexcept {
+        const auto length = prefix.size() + data.size();
+        if (length > SessionRecord::max_payload) { return; }
+
+        lock();
+
+        if (_paused) {
+            unlock();
+            return;
+        }
+
+        if (_size == 0) {
+            _head_time = _start_time = now;
+        }
+
+        auto delta = (now > _head_time) ? now - _head_time : 0;
+        const bool needs_time = delta > 0xFFFF;
+
+        // A gap would desynchronize replay from this point: keep the complete prefix only
+        const auto needed = SessionRecord::header_size + length + (needs_time ? SessionRecord::header_size + 4 : 0);
+        if (_full or capacity - _size < needed) {
+            _full = true;
+            _dropped += 1;
+            unlock();
+            return;
+        }
+
+        if (needs_time) {
+            const kf::u8 time[4] = {
+                static_cast<kf::u8>(now & 0xFF),
+                static_cast<kf::u8>((now >> 8) & 0xFF),
+                static_cast<kf::u8>((now >> 16) & 0xFF),
+                static_cast<kf::u8>((now >> 24) & 0xFF),
+            };
+            append(Kind::Time, 0, {}, {time, sizeof(time)});
+            delta = 0;
+        }
+
+        _head_time = now;
+        append(kind, static_cast<kf::u16>(delta), prefix, data);
+
+        unlock();
+    }
+
+    void append(Kind kind, kf::u16 delta, kf::memory::Slice<const kf::u8> prefix, kf::memory::Slice<const kf::u8> data) noexcept {
+        const auto length = prefix.size() + data.size();
+
+        put(static_cast<kf::u8>(kind));
+        put(static_cast<kf::u8>(delta & 0xFF));
+        put(static_cast<kf::u8>(delta >> 8));
+        put(static_cast<kf::u8>(length));
+        for (auto b: prefix) { put(b); }
+        for (auto b: data) { put(b); }
+    }
+
+    void put(kf::u8 b) noexcept {
+        _buffer[_size] = b;
+        _size += 1;
+    }
+};
+
+}// namespace djc::diagnostics
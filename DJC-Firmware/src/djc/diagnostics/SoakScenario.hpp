@@ -0,0 +1,191 @@
+// Copyright (c) 2026 KiraFlux
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#pragma once
+
+#include <kf/Logger.hpp>
+#include <kf/aliases.hpp>
+#include <kf/math/units.hpp>
+#include <kf/memory/Array.hpp>
+#include <kf/memory/ArrayString.hpp>
+#include <kf/memory/Slice.hpp>
+#include <kf/mixin/NonCopyable.hpp>
+
+#include "djc/Control.hpp"
+#include "djc/input/InputFrame.hpp"
+#include "djc/prelude.hpp"
+
+namespace djc::diagnostics {
+
+/// @brief Scripted inputs and peers for accelerated soak runs under the virtual clock
+/// @details Timeline:
+/// - scripted navigation opens Peer Explorer and enables control;
+/// - unknown peers keep joining, beaconing for a limited lifetime and going silent (peer expiry) for the whole run,
+///   every cycle under new MACs so discovery keeps inserting and evicting;
+/// - the active peer answers until link_drop_at, then goes silent (receive timeout);
+/// - left stick sweeps continuously so control frames keep flowing;
+/// - ticks take scripted time (work, interrupt latency, occasional flash-commit stalls), so the virtual clock does not
+///   land exactly on the tick grid and loop drift is measurable.
+struct SoakScenario final : kf::mixin::NonCopyable {
+
+    struct Config {
+        kf::math::Milliseconds duration;
+        kf::math::Milliseconds report_period;
+        kf::math::Milliseconds beacon_period;
+        kf::math::Milliseconds peer_lifetime;
+        kf::math::Milliseconds peer_spawn_period;
+        kf::math::Milliseconds link_drop_at;
+        kf::math::Milliseconds jitter_max;  // per tick
+        kf::math::Milliseconds stall;       // long tick, longer than the loop period
+        kf::math::Milliseconds stall_period;// average time between stalls
+
+        static constexpr Config defaults() noexcept {
+            return Config{
+                .duration = 4ul * 60 * 60 * 1000,// 4 h
+                .report_period = 10ul * 60 * 1000,// 10 min
+                .beacon_period = 250,
+                .peer_lifetime = 60'000,
+                .peer_spawn_period = 45'000,
+                .link_drop_at = 30ul * 60 * 1000,// 30 min
+                .jitter_max = 4,
+                .stall = 45,
+                .stall_period = 10'000,
+            };
+        }
+    };
+
+    explicit SoakScenario(const Config &config, Control &control) noexcept :
+        _config{config}, _control{control} {}
+
+    [[nodiscard]] const Config &config() const noexcept { return _config; }
+
+    [[nodiscard]] bool finished(kf::math::Milliseconds elapsed) const noexcept { return elapsed >= _config.duration; }
+
+    /// @brief Scripted input frame for given elapsed time
+    [[nodiscard]] input::InputFrame frame(kf::math::Milliseconds now, kf::math::Milliseconds elapsed) const noexcept {
+        input::InputFrame frame{
+            .timestamp = now,
+            .left_joystick = {.x = sweep(elapsed, 4000), .y = sweep(elapsed, 7000)},
+            .right_joystick = {.x = 0, .y = 0},
+            .left_button = {.pressed = false, .clicked = false},
+            .right_button = {.pressed = false, .clicked = false},
+        };
+
+        for (const auto &step: steps) {
+            if (elapsed < step.at or elapsed >= step.at + step.hold) { continue; }
+
+            frame.right_joystick.y = step.right_y;
+            frame.left_button.pressed = step.left_click;
+            frame.right_button.pressed = step.right_click;
+
+            // Click edge only on the first tick of the step
+            const auto first_tick = elapsed < step.at + tick_span;
+            frame.left_button.clicked = step.left_click and first_tick;
+            frame.right_button.clicked = step.right_click and first_tick;
+        }
+
+        return frame;
+    }
+
+    /// @brief Virtual time taken by the current tick
+    [[nodiscard]] kf::math::Milliseconds jitter(kf::math::Milliseconds period) noexcept {
+        const auto value = random();
+
+        // One stall every stall_period on average
+        if (value % (_config.stall_period / period) == 0) { return _config.stall; }
+
+        return (value >> 8) % (_config.jitter_max + 1);
+    }
+
+    /// @brief Deliver scripted peer traffic due at given elapsed time
+    void poll(kf::math::Milliseconds elapsed) noexcept {
+        if (elapsed < _next_beacon) { return; }
+        _next_beacon = elapsed + _config.beacon_period;
+
+        static constexpr kf::u8 beacon[] = {'D', 'J', 'C', '-', 'S', 'O', 'A', 'K'};
+
+        // Peer i joins at i * peer_spawn_period of every cycle
+        const auto cycle = peers_total * _config.peer_spawn_period;
+
+        for (kf::u8 i = 0; i < peers_total; i += 1) {
+            const auto spawn = i * _config.peer_spawn_period;
+            if (elapsed < spawn) { continue; }
+
+            const auto since_spawn = elapsed - spawn;
+            if (since_spawn % cycle >= _config.peer_lifetime) { continue; }
+
+            const auto generation = static_cast<kf::u8>(since_spawn / cycle);
+            _control.receiveFromUnknown(peerMac(i, generation), {beacon, sizeof(beacon)});
+        }
+
+        if (elapsed < _config.link_drop_at) {
+            if (not _control.connected()) { _control.connect(peerMac(active_peer)); }
+            _control.receive({beacon, sizeof(beacon)});
+        }
+
+        trackLink(elapsed);
+    }
+
+private:
+    static constexpr auto logger{kf::Logger::create("Soak")};
+
+    static constexpr kf::u8 peers_total{6};
+    static constexpr kf::u8 active_peer{peers_total};// not among beaconing peers
+    static constexpr kf::math::Milliseconds tick_span{20};
+
+    struct Step {
+        kf::math::Milliseconds at, hold;
+        kf::f32 right_y;
+        bool left_click, right_click;
+    };
+
+    // Root page: MAV Link, Raw Control, Peer Explorer, ...
+    static constexpr Step steps[] = {
+        {.at = 500, .hold = 100, .right_y = -1.0f, .left_click = false, .right_click = false},// Down
+        {.at = 1000, .hold = 100, .right_y = -1.0f, .left_click = false, .right_click = false},// Down
+        {.at = 1500, .hold = 100, .right_y = 0.0f, .left_click = false, .right_click = true},// Open Peer Explorer
+        {.at = 2000, .hold = 100, .right_y = 0.0f, .left_click = true, .right_click = false},// Enable control
+    };
+
+    const Config &_config;
+    Control &_control;
+    kf::math::Milliseconds _next_beacon{0};
+    kf::u32 _random{0x2545F491};
+    bool _was_connected{false};
+
+    static EspNow::Mac peerMac(kf::u8 index, kf::u8 generation = 0) noexcept { return EspNow::Mac{0x02, 0xD1, 0xC0, 0x00, generation, index}; }
+
+    /// @brief xorshift32: same sequence every run
+    kf::u32 random() noexcept {
+        _random ^= _random << 13;
+        _random ^= _random >> 17;
+        _random ^= _random << 5;
+        return _random;
+    }
+
+    /// @brief Triangle wave [-1; 1]
+    static kf::f32 sweep(kf::math::Milliseconds elapsed, kf::math::Milliseconds period) noexcept {
+        const auto phase = static_cast<kf::f32>(elapsed % period) / static_cast<kf::f32>(period);
+        return (phase < 0.5f) ? (phase * 4.0f - 1.0f) : (3.0f - phase * 4.0f);
+    }
+
+    void trackLink(kf::math::Milliseconds elapsed) noexcept {
+        const auto connected = _control.connected();
+        if (connected == _was_connected) { return; }
+        _was_connected = connected;
+
+        if (connected) {
+            logger.info(kf::memory::ArrayString<48>::formatted("Link up at %lu ms", static_cast<unsigned long>(elapsed)).view());
+            return;
+        }
+
+        logger.info(
+            kf::memory::ArrayString<64>::formatted(
+                "Link lost at %lu ms (%lu ms after drop)",
+                static_cast<unsigned long>(elapsed),
+                static_cast<unsigned long>(elapsed - _config.link_drop_at))
+                .view());
+    }
+};
+
+}// namespace djc::diagnostics
@@ -0,0 +1,383 @@
+// Copyright (c) 2026 KiraFlux
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#pragma once
+
+#include <MAVLink.h>
+
+#include <kf/Logger.hpp>
+#include <kf/aliases.hpp>
+#include <kf/math/units.hpp>
+#include <kf/memory/Array.hpp>
+#include <kf/memory/ArrayString.hpp>
+#include <kf/memory/Slice.hpp>
+#include <kf/mixin/NonCopyable.hpp>
+#include <kf/mixin/Singleton.hpp>
+
+#include "djc/diagnostics/Cycles.hpp"
+#include "djc/diagnostics/Histogram.hpp"
+#include "djc/prelude.hpp"
+
+/// Simulated vehicle hooks. Enabled with `-D DJC_VEHICLE_SIM`, otherwise expands to nothing
+#if defined(DJC_VEHICLE_SIM)
+#define DJC_VEHICLE_SIM_CALL(method, ...) ::djc::diagnostics::VehicleSimulator::instance().method(__VA_ARGS__)
+#else
+#define DJC_VEHICLE_SIM_CALL(method, ...) ((void) 0)
+#endif
+
+namespace djc::diagnostics {
+
+namespace internal {
+
+enum class VehicleFraming : kf::u8 {
+    PerMessage,// one MAVLink frame per ESP-NOW payload
+    Split,     // every frame split across two payloads
+    Coalesce,  // frames packed until the payload is full
+};
+
+struct VehicleSimulatorConfig {
+    // Stream rates, Hz (0 disables the stream)
+    kf::u16 attitude_rate, imu_rate, status_rate, serial_rate, param_rate;
+
+    VehicleFraming framing;
+    kf::u8 loss_percent, reorder_percent;
+
+    kf::math::Milliseconds report_period;
+
+    /// Double all rates every report until receive path load reaches target or the controller starts dropping
+    bool ramp;
+    kf::u8 target_load_percent;
+
+    static constexpr VehicleSimulatorConfig defaults() noexcept {
+        return VehicleSimulatorConfig{
+            .attitude_rate = 50,
+            .imu_rate = 50,
+            .status_rate = 2,
+            .serial_rate = 1,
+            .param_rate = 5,
+            .framing = VehicleFraming::Coalesce,
+            .loss_percent = 2,
+            .reorder_percent = 2,
+            .report_period = 5000,
+            .ramp = true,
+            .target_load_percent = 50,
+        };
+    }
+};
+
+}// namespace internal
+
+/// @brief Stand-in MAVLink vehicle feeding Control's receive path without a radio peer
+/// @note Telemetry is delivered through Control::receive() from the control tick as it is generated, so the offered rate
+/// is never capped by the simulator; controller packets are tapped on send
+struct VehicleSimulator final : kf::mixin::Singleton<VehicleSimulator> {
+    using Config = internal::VehicleSimulatorConfig;
+    using Framing = internal::VehicleFraming;
+
+    using Deliver = void (*)(kf::memory::Slice<const kf::u8>);
+
+    static constexpr EspNow::Mac mac{0x02, 0xD1, 0xC0, 0x5E, 0x11, 0xAA};
+
+    static constexpr kf::usize payload_capacity{250};// ESP-NOW payload limit
+
+    void configure(const Config &config) noexcept {
+        _config = config;
+        _rate_scale = 1;
+    }
+
+    /// @brief Controller sent a packet to the vehicle
+    void onControllerPacket(kf::memory::Slice<const kf::u8> packet) noexcept {
+        mavlink_message_t message;
+        mavlink_status_t status;
+
+        for (auto b: packet) {
+            if (mavlink_parse_char(MAVLINK_COMM_1, b, &message, &status) == 0) { continue; }
+
+            switch (message.msgid) {
+                case MAVLINK_MSG_ID_MANUAL_CONTROL:
+                    _manual_controls += 1;
+                    break;
+
+                case MAVLINK_MSG_ID_HEARTBEAT:
+                    _heartbeat_due = true;// answer with own heartbeat
+                    break;
+
+                default:
+                    break;
+            }
+        }
+    }
+
+    /// @brief Generate and deliver due telemetry
+    /// @param controller_drops Telemetry dropped on the controller side so far (readers falling behind)
+    void poll(kf::math::Milliseconds now, Deliver deliver, kf::u32 controller_drops) noexcept {
+        _deliver = deliver;
+        _controller_drops_total = controller_drops;
+
+        if (not _started) {
+            _started = true;
+            for (auto &s: _streams) { s.next = now; }
+            _window_start = now;
+            _window_start_cycles = cycles();
+            _window_controller_drops = controller_drops;
+        }
+
+        if (_heartbeat_due) {
+            _heartbeat_due = false;
+            emitHeartbeat();
+        }
+
+        emitDue(Stream::Attitude, _config.attitude_rate, now);
+        emitDue(Stream::Imu, _config.imu_rate, now);
+        emitDue(Stream::Status, _config.status_rate, now);
+        emitDue(Stream::Serial, _config.serial_rate, now);
+        emitDue(Stream::Param, _config.param_rate, now);
+
+        flushStaging();
+
+        if (now - _window_start >= _config.report_period) {
+            reportWindow(now);
+        }
+    }
+
+private:
+    static constexpr auto logger{kf::Logger::create("VehicleSim")};
+
+    static constexpr kf::u8 system_id{1};
+    static constexpr kf::u16 params_total{32};
+
+    enum class Stream : kf::u8 {
+        Attitude,
+        Imu,
+        Status,
+        Serial,
+        Param,
+    };
+
+    struct StreamState {
+        kf::math::Milliseconds next;
+    };
+
+    struct Payload {
+        kf::u8 length;
+        kf::memory::Array<kf::u8, payload_capacity> data;
+    };
+
+    Config _config{Config::defaults()};
+    kf::u8 _rate_scale{1};
+
+    kf::memory::Array<StreamState, 5> _streams{};
+    Payload _staging{};
+    Payload _held{};// delivered after the next payload: out-of-order
+    Deliver _deliver{nullptr};
+
+    kf::u32 _random{0x2545F491};
+    kf::u16 _param_index{0};
+    bool _started{false}, _heartbeat_due{false};
+
+    // statistics (current window)
+    kf::math::Milliseconds _window_start{0};
+    Cycles _window_start_cycles{0};
+    kf::u64 _receive_cycles{0};
+    kf::u32 _messages{0}, _payloads{0}, _bytes{0}, _dropped{0}, _manual_controls{0};
+    kf::u32 _controller_drops_total{0}, _window_controller_drops{0};
+    Histogram<16> _receive_time{Histogram<16>::defaults()};// us per payload
+
+    kf::u32 random() noexcept {
+        _random ^= _random << 13;
+        _random ^= _random >> 17;
+        _random ^= _random << 5;
+        return _random;
+    }
+
+    bool chance(kf::u8 percent) noexcept { return (random() % 100) < percent; }
+
+    void emitDue(Stream stream, kf::u16 rate, kf::math::Milliseconds now) noexcept {
+        if (rate == 0) { return; }
+
+        const auto scaled = static_cast<kf::u32>(rate) * _rate_scale;
+        const auto period = (scaled >= 1000) ? 1 : static_cast<kf::math::Milliseconds>(1000 / scaled);
+
+        auto &state = _streams[static_cast<kf::u8>(stream)];
+        while (now >= state.next) {
+            state.next += period;
+            emit(stream, now);
+        }
+    }
+
+    void emit(Stream stream, kf::math::Milliseconds now) noexcept {
+        mavlink_message_t message;
+
+        switch (stream) {
+            case Stream::Attitude: {
+                mavlink_attitude_quaternion_t attitude{};
+                attitude.time_boot_ms = now;
+                attitude.q1 = 1.0f;
+                attitude.q2 = static_cast<kf::f32>(static_cast<kf::i32>(random() % 200) - 100) * 0.001f;
+                attitude.q3 = static_cast<kf::f32>(static_cast<kf::i32>(random() % 200) - 100) * 0.001f;
+                mavlink_msg_attitude_quaternion_encode(system_id, MAV_COMP_ID_AUTOPILOT1, &message, &attitude);
+            } break;
+
+            case Stream::Imu: {
+                mavlink_scaled_imu_t imu{};
+                imu.time_boot_ms = now;
+                imu.xacc = static_cast<kf::i16>(random() % 64) - 32;
+                imu.yacc = static_cast<kf::i16>(random() % 64) - 32;
+                imu.zacc = 1000;
+                mavlink_msg_scaled_imu_encode(system_id, MAV_COMP_ID_AUTOPILOT1, &message, &imu);
+            } break;
+
+            case Stream::Status: {
+                mavlink_sys_status_t status{};
+                status.voltage_battery = 3900;
+                status.current_battery = 120;
+                status.battery_remaining = 80;
+                mavlink_msg_sys_status_encode(system_id, MAV_COMP_ID_AUTOPILOT1, &message, &status);
+            } break;
+
+            case Stream::Serial: {
+                mavlink_serial_control_t serial{};
+                const auto text = kf::memory::ArrayString<32>::formatted("sim t=%lu\n", static_cast<unsigned long>(now));
+                serial.count = static_cast<kf::u8>(text.view().size());
+                for (kf::usize i = 0; i < serial.count; i += 1) { serial.data[i] = static_cast<kf::u8>(text.data()[i]); }
+                mavlink_msg_serial_control_encode(system_id, MAV_COMP_ID_AUTOPILOT1, &message, &serial);
+            } break;
+
+            case Stream::Param: {
+                mavlink_param_value_t param{};
+                const auto id = kf::memory::ArrayString<16>::formatted("SIM_P%02u", static_cast<unsigned>(_param_index));
+                for (kf::usize i = 0; i < id.view().size(); i += 1) { param.param_id[i] = id.data()[i]; }
+                param.param_value = static_cast<kf::f32>(_param_index);
+                param.param_count = params_total;
+                param.param_index = _param_index;
+                param.param_type = MAV_PARAM_TYPE_REAL32;
+                mavlink_msg_param_value_encode(system_id, MAV_COMP_ID_AUTOPILOT1, &message, &param);
+
+                _param_index = (_param_index + 1) % params_total;
+            } break;
+        }
+
+        stage(message);
+    }
+
+    void emitHeartbeat() noexcept {
+        mavlink_heartbeat_t heartbeat{};
+        heartbeat.type = MAV_TYPE_QUADROTOR;
+        heartbeat.autopilot = MAV_AUTOPILOT_GENERIC;
+        heartbeat.system_status = MAV_STATE_ACTIVE;
+
+        mavlink_message_t message;
+        mavlink_msg_heartbeat_encode(system_id, MAV_COMP_ID_AUTOPILOT1, &message, &heartbeat);
+        stage(message);
+    }
+
+    void stage(const mavlink_message_t &message) noexcept {
+        kf::u8 frame[MAVLINK_MAX_PACKET_LEN];
+        const auto length = mavlink_msg_to_send_buffer(frame, &message);
+        _messages += 1;
+
+        switch (_config.framing) {
+            case Framing::PerMessage:
+                send({frame, length});
+                return;
+
+            case Framing::Split: {
+                const auto half = static_cast<kf::u16>(length / 2);
+                send({frame, half});
+                send({frame + half, static_cast<kf::usize>(length - half)});
+            }
+                return;
+
+            case Framing::Coalesce:
+                if (_staging.length + length > payload_capacity) { flushStaging(); }
+
+                for (kf::u16 i = 0; i < length; i += 1) { _staging.data[_staging.length + i] = frame[i]; }
+                _staging.length += length;
+                return;
+        }
+    }
+
+    void flushStaging() noexcept {
+        if (_staging.length == 0) { return; }
+
+        send({_staging.data.data(), _staging.length});
+        _staging.length = 0;
+    }
+
+    /// @brief Put a payload on the air, possibly holding it back behind the next one
+    void send(kf::memory::Slice<const kf::u8> data) noexcept {
+        if (_held.length == 0 and chance(_config.reorder_percent)) {
+            _held.length = static_cast<kf::u8>(data.size());
+            for (kf::usize i = 0; i < data.size(); i += 1) { _held.data[i] = data[i]; }
+            return;
+        }
+
+        deliver(data);
+
+        if (_held.length != 0) {
+            deliver({_held.data.data(), _held.length});
+            _held.length = 0;
+        }
+    }
+
+    void deliver(kf::memory::Slice<const kf::u8> data) noexcept {
+        if (chance(_config.loss_percent)) {
+            _dropped += 1;
+            return;
+        }
+
+        const auto begin = cycles();
+        _deliver(data);
+        const auto spent = cycles() - begin;
+
+        _receive_cycles += spent;
+        _receive_time.add(spent / cyclesPerMicrosecond());
+        _payloads += 1;
+        _bytes += data.size();
+    }
+
+    void reportWindow(kf::math::Milliseconds now) noexcept {
+        const auto window_ms = now - _window_start;
+        const auto window_cycles = static_cast<kf::u64>(cycles() - _window_start_cycles);
+        const auto load_percent = (window_cycles == 0) ? 0 : static_cast<kf::u32>(_receive_cycles * 100 / window_cycles);
+        const auto messages_per_second = _messages * 1000 / (window_ms == 0 ? 1 : window_ms);
+        const auto controller_drops = _controller_drops_total - _window_controller_drops;
+
+        logger.info(
+            kf::memory::ArrayString<96>::formatted(
+                "x%u: %lu msg/s %lu B/s, rx load %lu%%, p99 %lu us/payload",
+                static_cast<unsigned>(_rate_scale),
+                static_cast<unsigned long>(messages_per_second),
+                static_cast<unsigned long>(_bytes * 1000 / (window_ms == 0 ? 1 : window_ms)),
+                static_cast<unsigned long>(load_percent),
+                static_cast<unsigned long>(_receive_time.percentile(99)))
+                .view());
+
+        logger.info(
+            kf::memory::ArrayString<96>::formatted(
+                "payloads %lu lost %lu, controller drops %lu, controls received %lu",
+                static_cast<unsigned long>(_payloads),
+                static_cast<unsigned long>(_dropped),
+                static_cast<unsigned long>(controller_drops),
+                static_cast<unsigned long>(_manual_controls))
+                .view());
+
+        if (_config.ramp) {
+            if (load_percent >= _config.target_load_percent or controller_drops > 0) {
+                logger.info(kf::memory::ArrayString<64>::formatted("Sustainable limit ~%lu msg/s", static_cast<unsigned long>(messages_per_second)).view());
+                _config.ramp = false;
+            } else if (_rate_scale < 128) {
+                _rate_scale *= 2;
+            }
+        }
+
+        _window_start = now;
+        _window_start_cycles = cycles();
+        _window_controller_drops = _controller_drops_total;
+        _receive_cycles = 0;
+        _messages = _payloads = _bytes = _dropped = _manual_controls = 0;
+        _receive_time.reset();
+    }
+};
+
+}// namespace djc::diagnostics
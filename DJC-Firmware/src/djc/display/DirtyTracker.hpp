@@ -0,0 +1,129 @@
+// Copyright (c) 2026 KiraFlux
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#pragma once
+
+#include <kf/aliases.hpp>
+#include <kf/math/units.hpp>
+#include <kf/memory/Array.hpp>
+
+#include "djc/display/Window.hpp"
+
+namespace djc::display {
+
+/// @brief Detects changed screen regions between frames by hashing framebuffer tiles
+/// @details Changed tiles of a tile row form one window (min..max changed column),
+/// vertically adjacent windows with the same span are merged
+/// @note A hash collision hides a change: callers resend one tile row at a time (invalidateRow) to bound how long a
+/// tile stays stale without sending whole frames
+template<typename P> struct DirtyTracker {
+    static constexpr kf::math::Pixels tile_width{16};
+    static constexpr kf::math::Pixels tile_height{8};
+    static constexpr kf::usize max_tiles{(160 / tile_width) * (160 / tile_height)};// any ST7735 orientation
+
+    /// @brief Next collect reports the whole frame
+    void invalidate() noexcept { _valid = false; }
+
+    /// @brief Next collect reports a whole tile row
+    void invalidateRow(kf::u8 row) noexcept { _stale_row = row; }
+
+    /// @return Tile rows of a frame
+    static constexpr kf::u8 rowsOf(kf::math::Pixels height) noexcept { return static_cast<kf::u8>((height + tile_height - 1) / tile_height); }
+
+    /// @brief Compare frame against previous one
+    /// @param on_window Called with every changed window
+    /// @return Changed windows count
+    template<typename F> kf::u8 collect(const P *frame, kf::math::Pixels width, kf::math::Pixels height, F &&on_window) noexcept {
+        const auto columns = static_cast<kf::math::Pixels>((width + tile_width - 1) / tile_width);
+        const auto rows = static_cast<kf::math::Pixels>(rowsOf(height));
+
+        kf::u8 emitted{0};
+        bool pending{false};
+        Window window{};
+
+        for (kf::math::Pixels row = 0; row < rows; row += 1) {
+            kf::i16 first{-1}, last{-1};
+
+            for (kf::math::Pixels column = 0; column < columns; column += 1) {
+                auto &stored = _hashes[row * columns + column];
+                const auto hash = tileHash(frame, width, height, column, row);
+
+                if (_valid and row != _stale_row and stored == hash) { continue; }
+                stored = hash;
+
+                if (first < 0) { first = column; }
+                last = column;
+            }
+
+            if (first < 0) {
+                if (pending) {
+                    on_window(window);
+                    emitted += 1;
+                    pending = false;
+                }
+                continue;
+            }
+
+            const auto right = (last + 1) * tile_width - 1;
+            const auto bottom = (row + 1) * tile_height - 1;
+
+            const Window band{
+                .left = static_cast<kf::math::Pixels>(first * tile_width),
+                .top = static_cast<kf::math::Pixels>(row * tile_height),
+                .right = static_cast<kf::math::Pixels>(right < width ? right : width - 1),
+                .bottom = static_cast<kf::math::Pixels>(bottom < height ? bottom : height - 1),
+            };
+
+            if (pending and window.left == band.left and window.right == band.right) {
+                window.bottom = band.bottom;
+                continue;
+            }
+
+            if (pending) {
+                on_window(window);
+                emitted += 1;
+            }
+
+            window = band;
+            pending = true;
+        }
+
+        if (pending) {
+            on_window(window);
+            emitted += 1;
+        }
+
+        _valid = true;
+        _stale_row = -1;
+        return emitted;
+    }
+
+private:
+    kf::memory::Array<kf::u32, max_tiles> _hashes{};
+    kf::i16 _stale_row{-1};
+    bool _valid{false};
+
+    static kf::u32 tileHash(const P *frame, kf::math::Pixels width, kf::math::Pixels height, kf::math::Pixels column, kf::math::Pixels row) noexcept {
+        // FNV-1a over raw tile pixels
+        kf::u32 hash{2166136261u};
+
+        const auto x0 = column * tile_width;
+        const auto y0 = row * tile_height;
+        const auto x1 = (x0 + tile_width < width) ? x0 + tile_width : width;
+        const auto y1 = (y0 + tile_height < height) ? y0 + tile_height : height;
+
+        for (auto y = y0; y < y1; y += 1) {
+            const auto *line = reinterpret_cast<const kf::u8 *>(frame + y * width + x0);
+            const auto bytes = (x1 - x0) * sizeof(P);
+
+            for (kf::usize i = 0; i < bytes; i += 1) {
+                hash ^= line[i];
+                hash *= 16777619u;
+            }
+        }
+
+        return hash;
+    }
+};
+
+}// namespace djc::display
@@ -0,0 +1,153 @@
+// Copyright (c) 2026 KiraFlux
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#pragma once
+
+#include <atomic>
+
+#include <Arduino.h>// for FreeRTOS
+#include <esp_timer.h>
+
+#include <kf/Logger.hpp>
+#include <kf/Option.hpp>
+#include <kf/aliases.hpp>
+#include <kf/math/units.hpp>
+#include <kf/memory/Array.hpp>
+#include <kf/mixin/Initable.hpp>
+#include <kf/mixin/NonCopyable.hpp>
+
+#include "djc/display/Window.hpp"
+#include "djc/display/WindowTransport.hpp"
+
+namespace djc::display {
+
+/// @brief Transmits a frame's windows from a background task, so the main loop keeps running during the SPI transfer
+/// @details Windows are read from the framebuffer while they are sent (the transport copies them band by band into its
+/// DMA buffers): the owner must not draw until busy() clears. The frame is complete when the transport callback
+/// reports its last band sent (see takeResult())
+template<typename P> struct FlushTask final : kf::mixin::NonCopyable, kf::mixin::Initable<FlushTask<P>, bool> {
+
+    static constexpr kf::u8 max_windows{20};
+
+    /// @brief Completed frame
+    struct Result {
+        kf::u32 bytes;
+        kf::u32 duration_us;
+        kf::u8 windows;
+        bool failed;// transport error, the panel may show parts of older frames
+    };
+
+    explicit FlushTask(WindowTransport &transport) noexcept :
+        _transport{transport} {}
+
+    /// @brief Frame is still being transmitted, the framebuffer must not change
+    [[nodiscard]] bool busy() const noexcept { return _busy.load(std::memory_order_acquire); }
+
+    /// @brief Queue window of the next frame. Excess windows are merged into the last one
+    void add(const Window &window) noexcept {
+        if (_windows_total < max_windows) {
+            _windows[_windows_total] = window;
+            _windows_total += 1;
+        } else {
+            _windows[max_windows - 1] = _windows[max_windows - 1].merged(window);
+        }
+    }
+
+    /// @brief Start transmitting queued windows of the frame
+    /// @note Sends in place when the task could not be started
+    void submit(const P *frame, kf::math::Pixels stride) noexcept {
+        _frame = frame;
+        _stride = stride;
+
+        kf::u32 bytes{0};
+        for (kf::u8 i = 0; i < _windows_total; i += 1) { bytes += WindowTransport::cost(_windows[i], sizeof(P)); }
+        _result = Result{.bytes = bytes, .duration_us = 0, .windows = _windows_total, .failed = false};
+
+        _start_us = esp_timer_get_time();
+        _busy.store(true, std::memory_order_release);
+
+        if (_task == nullptr) {
+            transmit();
+            return;
+        }
+
+        xTaskNotifyGive(_task);
+    }
+
+    /// @brief Frame completion: result of the last finished frame, once
+    [[nodiscard]] kf::Option<Result> takeResult() noexcept {
+        if (not _done.exchange(false, std::memory_order_acquire)) { return {}; }
+        return {_result};
+    }
+
+private:
+    static constexpr auto logger{kf::Logger::create("FlushTask")};
+
+    static constexpr kf::u32 stack_size{3072};
+    static constexpr UBaseType_t priority{2};
+    static constexpr BaseType_t core{0};// main loop runs on core 1
+
+    WindowTransport &_transport;
+    TaskHandle_t _task{nullptr};
+
+    kf::memory::Array<Window, max_windows> _windows{};
+    kf::u8 _windows_total{0};
+    const P *_frame{nullptr};
+    kf::math::Pixels _stride{0};
+
+    Result _result{};
+    kf::i64 _start_us{0};
+    std::atomic<bool> _busy{false};
+    std::atomic<bool> _done{false};
+
+    void transmit() noexcept {
+        const auto total = _windows_total;
+        _windows_total = 0;
+
+        for (kf::u8 i = 0; i < total; i += 1) {
+            // After the last window is queued the callback may complete the frame any moment: nothing is touched past it
+            if (not _transport.send(_windows[i], _frame, _stride, i + 1 == total)) {
+                _result.failed = true;
+                finish();
+                return;
+            }
+        }
+    }
+
+    /// @brief Publish the result, in the SPI interrupt when the frame went out
+    void finish() noexcept {
+        _result.duration_us = static_cast<kf::u32>(esp_timer_get_time() - _start_us);
+        _done.store(true, std::memory_order_release);
+        _busy.store(false, std::memory_order_release);
+    }
+
+    static void transmitted(void *self) { static_cast<FlushTask *>(self)->finish(); }
+
+    [[noreturn]] static void taskEntry(void *self) noexcept {
+        auto &flush_task = *static_cast<FlushTask *>(self);
+
+        while (true) {
+            (void) ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+            flush_task.transmit();
+        }
+    }
+
+    // impl
+
+    KF_IMPL_INITABLE(FlushTask, bool);
+    bool initImpl() noexcept {
+        _transport.onTransmitted(transmitted, this);
+
+        const auto created = xTaskCreatePinnedToCore(taskEntry, "djc-flush", stack_size, this, priority, &_task, core);
+
+        if (created != pdPASS) {
+            _task = nullptr;
+            logger.error("task not created, flushing synchronously");
+            return false;
+        }
+
+        return true;
+    }
+};
+
+}// namespace djc::display
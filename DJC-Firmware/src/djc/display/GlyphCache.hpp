@@ -0,0 +1,161 @@
+// Copyright (c) 2026 KiraFlux
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#pragma once
+
+#include <kf/aliases.hpp>
+#include <kf/math/units.hpp>
+#include <kf/memory/Array.hpp>
+#include <kf/mixin/Configurable.hpp>
+#include <kf/mixin/NonCopyable.hpp>
+
+namespace djc::display {
+
+namespace internal {
+
+enum class GlyphCacheEviction : kf::u8 {
+    LeastRecentlyUsed,// Replace the oldest glyph of the set
+    Never,            // Keep first glyphs, draw the rest uncached
+};
+
+struct GlyphCacheConfig {
+    kf::u8 capacity;// glyphs, rounded down to whole sets; 0 disables the cache
+    GlyphCacheEviction eviction;
+
+    static constexpr GlyphCacheConfig defaults() noexcept {
+        return GlyphCacheConfig{
+            .capacity = 64,
+            .eviction = GlyphCacheEviction::LeastRecentlyUsed,
+        };
+    }
+};
+
+}// namespace internal
+
+/// @brief Pre-rasterised glyph cells in native pixel format, keyed by character and colors
+/// @details Set-associative (4 ways): lookup compares at most 4 tags
+template<typename Pixel> struct GlyphCache final : kf::mixin::NonCopyable, kf::mixin::Configurable<internal::GlyphCacheConfig> {
+    using Config = internal::GlyphCacheConfig;
+    using Eviction = internal::GlyphCacheEviction;
+
+    static constexpr kf::u8 max_glyphs{64};
+    static constexpr kf::math::Pixels max_cell_width{8};
+    static constexpr kf::math::Pixels max_cell_height{8};
+
+    /// @brief Glyph appearance
+    struct Key {
+        Pixel foreground, background;// colors before escapes
+        kf::u8 reset, escape_background, escape_foreground;// active color escapes, 0 if none
+        char code;
+
+        [[nodiscard]] constexpr bool operator==(const Key &other) const noexcept {
+            return code == other.code and foreground == other.foreground and background == other.background and
+                   reset == other.reset and escape_background == other.escape_background and escape_foreground == other.escape_foreground;
+        }
+    };
+
+    struct Stats {
+        kf::u32 hits, misses, evictions;
+    };
+
+    explicit GlyphCache(const Config &config) noexcept :
+        kf::mixin::Configurable<Config>{config} {}
+
+    /// @brief Prepare for glyphs of given cell size, drops cached glyphs
+    /// @return false if the cell does not fit, cache stays disabled
+    bool cell(kf::math::Pixels width, kf::math::Pixels height) noexcept {
+        clear();
+
+        if (width > max_cell_width or height > max_cell_height) {
+            _sets = 0;
+            return false;
+        }
+
+        const auto capacity = this->config().capacity < max_glyphs ? this->config().capacity : max_glyphs;
+        _sets = capacity / ways;
+        return true;
+    }
+
+    [[nodiscard]] bool enabled() const noexcept { return _sets > 0; }
+
+    [[nodiscard]] const Stats &stats() const noexcept { return _stats; }
+
+    void clear() noexcept {
+        for (auto &tag: _tags) { tag.valid = false; }
+    }
+
+    /// @brief Cached cell of the glyph, rasterised on miss
+    /// @param rasterize Called as rasterize(Pixel *cell, stride) to fill a new cell
+    /// @return Cell pixels (stride max_cell_width) or nullptr when the glyph can not be cached
+    template<typename F> const Pixel *get(const Key &key, F &&rasterize) noexcept {
+        if (not enabled()) { return nullptr; }
+
+        _clock += 1;
+
+        const auto first = static_cast<kf::u8>(hash(key) % _sets) * ways;
+        kf::u8 victim{first};
+
+        for (kf::u8 i = first; i < first + ways; i += 1) {
+            auto &tag = _tags[i];
+
+            if (tag.valid and tag.key == key) {
+                tag.last_use = _clock;
+                _stats.hits += 1;
+                return cellAt(i);
+            }
+
+            if (not tag.valid) {
+                victim = i;
+            } else if (_tags[victim].valid and tag.last_use < _tags[victim].last_use) {
+                victim = i;
+            }
+        }
+
+        _stats.misses += 1;
+
+        auto &tag = _tags[victim];
+        if (tag.valid) {
+            if (this->config().eviction == Eviction::Never) { return nullptr; }
+            _stats.evictions += 1;
+        }
+
+        tag = Tag{.key = key, .last_use = _clock, .valid = true};
+        rasterize(cellAt(victim), max_cell_width);
+        return cellAt(victim);
+    }
+
+private:
+    static constexpr kf::u8 ways{4};
+    static constexpr kf::usize cell_pixels{max_cell_width * max_cell_height};
+
+    struct Tag {
+        Key key;
+        kf::u32 last_use;
+        bool valid;
+    };
+
+    kf::memory::Array<Tag, max_glyphs> _tags{};
+    kf::memory::Array<Pixel, max_glyphs * cell_pixels> _cells{};
+    kf::u8 _sets{0};
+    kf::u32 _clock{0};
+    Stats _stats{};
+
+    [[nodiscard]] Pixel *cellAt(kf::u8 index) noexcept { return _cells.data() + index * cell_pixels; }
+
+    [[nodiscard]] static kf::u32 hash(const Key &key) noexcept {
+        auto h = static_cast<kf::u32>(static_cast<kf::u8>(key.code));
+
+        const auto mix = [&h](const Pixel &color) {
+            const auto *bytes = reinterpret_cast<const kf::u8 *>(&color);
+            for (kf::usize i = 0; i < sizeof(Pixel); i += 1) { h = h * 31u + bytes[i]; }
+        };
+        mix(key.foreground);
+        mix(key.background);
+
+        h = h * 31u + key.escape_foreground;
+        h = h * 31u + key.escape_background;
+        return h;
+    }
+};
+
+}// namespace djc::display
@@ -0,0 +1,32 @@
+// Copyright (c) 2026 KiraFlux
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#pragma once
+
+#include <kf/math/units.hpp>
+#include <kf/memory/StringView.hpp>
+
+#include "djc/prelude.hpp"
+
+namespace djc::display {
+
+/// @brief Drawing into a screen area, in area coordinates, clipped to it
+struct Painter {
+    using Color = DisplayDriver::PixelImpl;
+
+    virtual ~Painter() = default;
+
+    [[nodiscard]] virtual kf::math::Pixels width() const noexcept = 0;
+
+    [[nodiscard]] virtual kf::math::Pixels height() const noexcept = 0;
+
+    [[nodiscard]] virtual kf::math::Pixels glyphHeight() const noexcept = 0;
+
+    /// @brief Fill rectangle, bounds inclusive
+    virtual void fill(int x0, int y0, int x1, int y1, Color color) noexcept = 0;
+
+    /// @brief Draw text at a y multiple of glyphHeight()
+    virtual void text(int x, int y, kf::memory::StringView str, Color foreground, Color background) noexcept = 0;
+};
+
+}// namespace djc::display
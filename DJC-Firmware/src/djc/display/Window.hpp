@@ -0,0 +1,36 @@
+// Copyright (c) 2026 KiraFlux
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#pragma once
+
+#include <kf/aliases.hpp>
+#include <kf/math/units.hpp>
+
+namespace djc::display {
+
+/// @brief Screen rectangle, bounds inclusive
+struct Window {
+    kf::math::Pixels left, top, right, bottom;
+
+    [[nodiscard]] constexpr kf::math::Pixels width() const noexcept { return right - left + 1; }
+
+    [[nodiscard]] constexpr kf::math::Pixels height() const noexcept { return bottom - top + 1; }
+
+    [[nodiscard]] constexpr kf::u32 area() const noexcept { return static_cast<kf::u32>(width()) * height(); }
+
+    [[nodiscard]] constexpr bool intersects(const Window &other) const noexcept {
+        return left <= other.right and other.left <= right and top <= other.bottom and other.top <= bottom;
+    }
+
+    /// @brief Smallest window containing both
+    [[nodiscard]] constexpr Window merged(const Window &other) const noexcept {
+        return Window{
+            .left = left < other.left ? left : other.left,
+            .top = top < other.top ? top : other.top,
+            .right = right > other.right ? right : other.right,
+            .bottom = bottom > other.bottom ? bottom : other.bottom,
+        };
+    }
+};
+
+}// namespace djc::display
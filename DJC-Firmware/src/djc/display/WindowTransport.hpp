@@ -0,0 +1,298 @@
+// Copyright (c) 2026 KiraFlux
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#pragma once
+
+#include <cstring>
+#include <initializer_list>
+
+#include <Arduino.h>
+#include <SPI.h>
+#include <driver/spi_master.h>
+#include <esp_heap_caps.h>
+
+#include <kf/Logger.hpp>
+#include <kf/aliases.hpp>
+#include <kf/math/units.hpp>
+#include <kf/memory/Array.hpp>
+#include <kf/mixin/Initable.hpp>
+#include <kf/mixin/NonCopyable.hpp>
+
+#include "djc/display/Window.hpp"
+
+namespace djc::display {
+
+/// @brief Pushes framebuffer windows to an ST7735 using its column/row address window
+/// @details Pixels go out by DMA through the ESP-IDF SPI master driver: a window is copied band by band into two small
+/// DMA-capable buffers, one is filled while the other is on the wire. Commands are short polled transfers
+/// @note The panel must be initialized (orientation, color mode) by the driver beforehand, init then takes the bus over
+/// from Arduino SPI; without a driver initPanel() does it. Windows are addressed in the orientation set through MADCTL,
+/// panel RAM offsets are added on top
+struct WindowTransport final : kf::mixin::NonCopyable, kf::mixin::Initable<WindowTransport, bool> {
+
+    struct Pins {
+        gpio_num_t mosi, clock, chip_select, data_command;
+    };
+
+    /// @brief Panel RAM position of the visible area, in the driver orientation (tab variants differ)
+    struct Offset {
+        kf::u8 column, row;
+    };
+
+    /// @brief Called from the SPI interrupt once the last band of a frame is sent
+    using Callback = void (*)(void *context);
+
+    static constexpr kf::usize band_bytes{160 * 8 * 2};// 8 rows of the widest ST7735 window, 16 bit pixels
+
+    explicit WindowTransport(SPIClass &spi, spi_host_device_t host, Pins pins, Offset offset, kf::u32 frequency) noexcept :
+        _spi{spi}, _host{host}, _pins{pins}, _offset{offset}, _frequency{frequency} {}
+
+    /// @brief Bytes a window transfer puts on the bus, commands included
+    [[nodiscard]] static constexpr kf::u32 cost(const Window &window, kf::usize pixel_size) noexcept {
+        return static_cast<kf::u32>(window.width()) * window.height() * pixel_size + command_overhead;
+    }
+
+    /// @brief Bytes pushed since last call
+    [[nodiscard]] kf::u32 takeBytesSent() noexcept {
+        const auto bytes = _bytes_sent;
+        _bytes_sent = 0;
+        return bytes;
+    }
+
+    /// @brief Set frame completion callback, see send()
+    void onTransmitted(Callback callback, void *context) noexcept {
+        _on_transmitted = callback;
+        _context = context;
+    }
+
+    /// @brief Send window of a framebuffer
+    /// @param frame First pixel of the framebuffer (already in display byte order)
+    /// @param stride Framebuffer width, pixels
+    /// @param last Last window of a frame: returns once its pixels are queued, the completion callback follows
+    /// @return All bands were queued
+    template<typename P> bool send(const Window &window, const P *frame, kf::math::Pixels stride, bool last) noexcept {
+        return sendRegion(window, frame + window.top * stride + window.left, stride, last);
+    }
+
+    /// @brief Send window from a buffer holding only (part of) its pixels, such as a render strip
+    /// @param origin Pixel drawn at the window top-left corner, the buffer is free again on return
+    /// @param stride Buffer width, pixels
+    template<typename P> bool sendRegion(const Window &window, const P *origin, kf::math::Pixels stride, bool last = false) noexcept {
+        const auto row_bytes = static_cast<kf::usize>(window.width()) * sizeof(P);
+        if (row_bytes > band_bytes) { return false; }
+
+        const bool addressed = command(caset) and address(window.left + _offset.column, window.right + _offset.column) and
+                               command(raset) and address(window.top + _offset.row, window.bottom + _offset.row) and
+                               command(ramwr);
+        if (not addressed) { return false; }
+
+        _bytes_sent += cost(window, sizeof(P));
+
+        const auto band_rows = static_cast<kf::math::Pixels>(band_bytes / row_bytes);
+        for (kf::math::Pixels row = 0; row < window.height(); row += band_rows) {
+            const auto rows = static_cast<kf::math::Pixels>(window.height() - row < band_rows ? window.height() - row : band_rows);
+
+            auto *band = nextBand();
+            if (band == nullptr) { return false; }
+
+            for (kf::math::Pixels r = 0; r < rows; r += 1) {
+                std::memcpy(band->pixels + r * row_bytes, origin + (row + r) * stride, row_bytes);
+            }
+
+            if (not queue(*band, rows * row_bytes, last and row + rows >= window.height())) { return false; }
+        }
+
+        return true;
+    }
+
+    /// @brief Reset and set up the panel, when no driver did
+    /// @param orientation MADCTL value: scan direction, row/column exchange and color order
+    bool initPanel(gpio_num_t reset_pin, kf::u8 orientation) noexcept {
+        pinMode(reset_pin, OUTPUT);
+        digitalWrite(reset_pin, LOW);
+        delay(reset_pulse);
+        digitalWrite(reset_pin, HIGH);
+        delay(reset_delay);
+
+        const bool configured = command(swreset) and pause(reset_delay) and
+                                command(slpout) and pause(sleep_out_delay) and
+                                command(colmod) and write(true, {colmod_16bit}) and
+                                command(madctl) and write(true, {orientation}) and
+                                command(noron) and command(dispon);
+
+        if (not configured) { logger.error("panel not configured"); }
+        return configured;
+    }
+
+    /// @brief Idle mode: 8 colors, lower panel drive current (the board has no backlight control)
+    void idle(bool enabled) noexcept { commands({enabled ? idmon : idmoff}); }
+
+    /// @brief Sleep in: panel off, display RAM kept. Sleep out waits for the panel to power up
+    void sleep(bool enabled) noexcept {
+        if (enabled) {
+            commands({dispoff, slpin});
+            return;
+        }
+
+        commands({slpout});
+        delay(sleep_out_delay);
+        commands({dispon});
+    }
+
+private:
+    static constexpr auto logger{kf::Logger::create("WindowTransport")};
+
+    static constexpr kf::u8 caset{0x2A}, raset{0x2B}, ramwr{0x2C};
+    static constexpr kf::u8 slpin{0x10}, slpout{0x11}, dispoff{0x28}, dispon{0x29}, idmoff{0x38}, idmon{0x39};
+    static constexpr kf::u8 swreset{0x01}, noron{0x13}, madctl{0x36}, colmod{0x3A}, colmod_16bit{0x05};
+    static constexpr kf::u32 sleep_out_delay{120};// ms, ST7735 datasheet
+    static constexpr kf::u32 reset_pulse{10}, reset_delay{150};// ms
+    static constexpr kf::u32 command_overhead{3 + 2 * 4};// commands + address bytes
+    static constexpr kf::u8 bands_total{2};
+
+    /// @brief Transaction with what the interrupt callbacks need to know about it
+    struct Transfer {
+        spi_transaction_t transaction;
+        WindowTransport *owner;
+        kf::u8 *pixels;// DMA buffer of a band, null for commands
+        bool data;     // DC level
+        bool last;     // frame end, completion callback runs after it
+    };
+
+    SPIClass &_spi;
+    const spi_host_device_t _host;
+    const Pins _pins;
+    const Offset _offset;
+    const kf::u32 _frequency;
+
+    spi_device_handle_t _device{nullptr};
+    Transfer _command{};
+    kf::memory::Array<Transfer, bands_total> _bands{};
+    kf::u8 _next_band{0}, _in_flight{0};
+
+    Callback _on_transmitted{nullptr};
+    void *_context{nullptr};
+    kf::u32 _bytes_sent{0};
+
+    /// @brief Band buffer to fill next, once its previous transfer is done
+    Transfer *nextBand() noexcept {
+        if (_in_flight == bands_total) {
+            // Results come back in queue order: this is the oldest band, the one to reuse
+            spi_transaction_t *done{nullptr};
+            if (spi_device_get_trans_result(_device, &done, portMAX_DELAY) != ESP_OK) { return nullptr; }
+            _in_flight -= 1;
+        }
+
+        return &_bands[_next_band];
+    }
+
+    bool queue(Transfer &band, kf::usize bytes, bool last) noexcept {
+        band.transaction.length = bytes * 8;
+        band.last = last;
+
+        if (spi_device_queue_trans(_device, &band.transaction, portMAX_DELAY) != ESP_OK) { return false; }
+
+        _in_flight += 1;
+        _next_band = static_cast<kf::u8>((_next_band + 1) % bands_total);
+        return true;
+    }
+
+    /// @brief Up to 4 bytes in one polled transfer, waits for queued bands first
+    bool write(bool data, std::initializer_list<kf::u8> bytes) noexcept {
+        if (_device == nullptr) { return false; }// init failed
+
+        auto &transaction = _command.transaction;
+        transaction = spi_transaction_t{};
+        transaction.flags = SPI_TRANS_USE_TXDATA;
+        transaction.length = bytes.size() * 8;
+        transaction.user = &_command;
+        std::memcpy(transaction.tx_data, bytes.begin(), bytes.size());
+        _command.data = data;
+
+        return spi_device_polling_transmit(_device, &transaction) == ESP_OK;
+    }
+
+    bool command(kf::u8 code) noexcept { return write(false, {code}); }
+
+    bool address(int start, int end) noexcept {
+        return write(true, {static_cast<kf::u8>(start >> 8), static_cast<kf::u8>(start), static_cast<kf::u8>(end >> 8), static_cast<kf::u8>(end)});
+    }
+
+    static bool pause(kf::u32 ms) noexcept {
+        delay(ms);
+        return true;
+    }
+
+    /// @brief Parameterless commands
+    void commands(std::initializer_list<kf::u8> codes) noexcept {
+        for (const auto code: codes) { (void) command(code); }
+    }
+
+    // SPI interrupt context
+
+    static void beforeTransfer(spi_transaction_t *transaction) {
+        const auto &transfer = *static_cast<const Transfer *>(transaction->user);
+        gpio_set_level(transfer.owner->_pins.data_command, transfer.data ? 1 : 0);
+    }
+
+    static void afterTransfer(spi_transaction_t *transaction) {
+        const auto &transfer = *static_cast<const Transfer *>(transaction->user);
+        auto &owner = *transfer.owner;
+
+        if (transfer.last and owner._on_transmitted != nullptr) { owner._on_transmitted(owner._context); }
+    }
+
+    // impl
+
+    KF_IMPL_INITABLE(WindowTransport, bool);
+    bool initImpl() noexcept {
+        // The driver is done with Arduino SPI after panel init: the bus is handed over to the SPI master driver
+        _spi.end();// no-op when Arduino SPI was never started
+
+        pinMode(_pins.data_command, OUTPUT);
+        _command.owner = this;
+
+        for (auto &band: _bands) {
+            band.pixels = static_cast<kf::u8 *>(heap_caps_malloc(band_bytes, MALLOC_CAP_DMA));
+            if (band.pixels == nullptr) {
+                logger.error("no DMA memory for band buffers");
+                return false;
+            }
+
+            band.owner = this;
+            band.data = true;
+            band.transaction.tx_buffer = band.pixels;
+            band.transaction.user = &band;
+        }
+
+        spi_bus_config_t bus{};
+        bus.mosi_io_num = _pins.mosi;
+        bus.miso_io_num = -1;
+        bus.sclk_io_num = _pins.clock;
+        bus.quadwp_io_num = -1;
+        bus.quadhd_io_num = -1;
+        bus.max_transfer_sz = band_bytes;
+
+        if (spi_bus_initialize(_host, &bus, SPI_DMA_CH_AUTO) != ESP_OK) {
+            logger.error("SPI bus not initialized");
+            return false;
+        }
+
+        spi_device_interface_config_t device{};
+        device.mode = 0;
+        device.clock_speed_hz = static_cast<int>(_frequency);
+        device.spics_io_num = _pins.chip_select;
+        device.queue_size = bands_total;
+        device.pre_cb = beforeTransfer;
+        device.post_cb = afterTransfer;
+
+        if (spi_bus_add_device(_host, &device, &_device) != ESP_OK) {
+            logger.error("SPI device not added");
+            return false;
+        }
+
+        return true;
+    }
+};
+
+}// namespace djc::display
@@ -0,0 +1,84 @@
+// Copyright (c) 2026 KiraFlux
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#pragma once
+
+#include <kf/aliases.hpp>
+#include <kf/math/units.hpp>
+#include <kf/mixin/Configurable.hpp>
+#include <kf/mixin/NonCopyable.hpp>
+
+#include "djc/input/InputFrame.hpp"
+
+namespace djc::input {
+
+namespace internal {
+
+struct DirectionListenerConfig final : kf::mixin::NonCopyable {
+    kf::f32 threshold;
+    kf::math::Milliseconds repeat_timeout;
+    kf::math::Milliseconds delay;
+};
+
+}// namespace internal
+
+/// @brief Converts joystick axes of an input frame into discrete navigation directions
+/// @note Fires on direction change, then repeats after delay while the stick is held
+struct DirectionListener final : kf::mixin::NonCopyable, kf::mixin::Configurable<internal::DirectionListenerConfig> {
+    using Config = internal::DirectionListenerConfig;
+
+    enum class Direction : kf::u8 {
+        Up = 0,
+        Down = 1,
+        Left = 2,
+        Right = 3,
+        Home = 4,
+    };
+
+    explicit DirectionListener(const Config &config) noexcept :
+        kf::mixin::Configurable<Config>{config} {}
+
+    [[nodiscard]] Direction direction() const noexcept { return _direction; }
+
+    /// @brief Check if direction was (re)triggered by the last update
+    [[nodiscard]] bool changed() const noexcept { return _changed; }
+
+    void update(const InputFrame::Axes &axes, kf::math::Milliseconds now) noexcept {
+        const auto direction = directionFromAxes(axes);
+
+        if (direction != _direction) {
+            _direction = direction;
+            _changed = true;
+            _next_repeat = now + this->config().delay;
+            return;
+        }
+
+        if (_direction != Direction::Home and now >= _next_repeat) {
+            _changed = true;
+            _next_repeat = now + this->config().repeat_timeout;
+            return;
+        }
+
+        _changed = false;
+    }
+
+private:
+    kf::math::Milliseconds _next_repeat{0};
+    Direction _direction{Direction::Home};
+    bool _changed{false};
+
+    [[nodiscard]] Direction directionFromAxes(const InputFrame::Axes &axes) const noexcept {
+        const auto abs_x = axes.x < 0 ? -axes.x : axes.x;
+        const auto abs_y = axes.y < 0 ? -axes.y : axes.y;
+
+        if (abs_x < this->config().threshold and abs_y < this->config().threshold) { return Direction::Home; }
+
+        if (abs_y >= abs_x) {
+            return axes.y > 0 ? Direction::Up : Direction::Down;
+        } else {
+            return axes.x > 0 ? Direction::Right : Direction::Left;
+        }
+    }
+};
+
+}// namespace djc::input
@@ -0,0 +1,30 @@
+// Copyright (c) 2026 KiraFlux
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#pragma once
+
+#include <kf/aliases.hpp>
+#include <kf/math/units.hpp>
+
+namespace djc::input {
+
+/// @brief Snapshot of every axis and button, sampled once per tick
+/// @note All consumers of a tick (navigation, control, diagnostics) must read the same frame
+struct InputFrame final {
+
+    struct Axes {
+        kf::f32 x, y;// Normalized, filtered [-1; 1]
+    };
+
+    struct Button {
+        bool pressed;// Debounced level
+        bool clicked;// Press edge registered during this tick
+    };
+
+    kf::math::Milliseconds timestamp;
+
+    Axes left_joystick, right_joystick;
+    Button left_button, right_button;
+};
+
+}// namespace djc::input
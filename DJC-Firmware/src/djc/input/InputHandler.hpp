@@ -5,29 +5,28 @@
 
 #include <utility>
 
-#include <kf/Function.hpp>
 #include <kf/aliases.hpp>
-#include <kf/input/JoystickListener.hpp>
-#include <kf/math/units.hpp>
 #include <kf/mixin/NonCopyable.hpp>
-#include <kf/mixin/TimedPollable.hpp>
 
-#include "djc/prelude.hpp"
+#include "djc/input/DirectionListener.hpp"
+#include "djc/input/InputFrame.hpp"
+#include "djc/memory/InplaceFunction.hpp"
 
 namespace djc {
 
-struct InputHandler final : kf::mixin::NonCopyable, kf::mixin::TimedPollable<InputHandler> {
-    using JoystickListener = kf::input::JoystickListener<Joystick>;
+/// @brief UI navigation front-end: turns input frames into click and direction callbacks
+struct InputHandler final : kf::mixin::NonCopyable {
+    using DirectionListener = input::DirectionListener;
 
-    using ClickCallback = kf::Function<void()>;
-    using DirectionCallback = kf::Function<void(JoystickListener::Direction)>;
+    using ClickCallback = memory::InplaceFunction<void()>;
+    using DirectionCallback = memory::InplaceFunction<void(DirectionListener::Direction)>;
 
     struct Config final : kf::mixin::NonCopyable {
-        JoystickListener::Config joystick_listener;
+        DirectionListener::Config direction_listener;
 
         static constexpr Config defaults() noexcept {
             return Config{
-                .joystick_listener = JoystickListener::Config{
+                .direction_listener = DirectionListener::Config{
                     .threshold = 0.6f,
                     .repeat_timeout = 100,// ms
                     .delay = 400,         // ms
@@ -36,14 +35,8 @@ struct InputHandler final : kf::mixin::NonCopyable, kf::mixin::TimedPollable<Inp
         }
     };
 
-    explicit InputHandler(
-        const Config &config,
-        Joystick &primary_joystick,
-        ButtonListener &left_button_listener,
-        ButtonListener &right_button_listener) noexcept :
-        _joystick_listener{primary_joystick, config.joystick_listener},
-        _left_button_listener{left_button_listener},
-        _right_button_listener{right_button_listener} {}
+    explicit InputHandler(const Config &config) noexcept :
+        _direction_listener{config.direction_listener} {}
 
     void onRightButton(ClickCallback &&callback) noexcept { _right_click_callback = std::move(callback); }
 
@@ -51,35 +44,29 @@ struct InputHandler final : kf::mixin::NonCopyable, kf::mixin::TimedPollable<Inp
 
     void onDirection(DirectionCallback &&callback) noexcept { _direction_callback = std::move(callback); }
 
-private:
-    JoystickListener _joystick_listener;
-    DirectionCallback _direction_callback{};
-
-    ButtonListener &_left_button_listener;
-    ClickCallback _left_click_callback{};
-
-    ButtonListener &_right_button_listener;
-    ClickCallback _right_click_callback{};
-
-    // impl
-
-    KF_IMPL_TIMED_POLLABLE(InputHandler);
-    void pollImpl(kf::math::Milliseconds now) noexcept {
-        _left_button_listener.poll(now);
-        if (_left_click_callback and _left_button_listener.clicked()) {
+    /// @brief Dispatch callbacks for the current tick
+    /// @param frame Input snapshot of this tick (right joystick drives navigation)
+    void update(const input::InputFrame &frame) noexcept {
+        if (_left_click_callback and frame.left_button.clicked) {
             _left_click_callback();
         }
 
-        _right_button_listener.poll(now);
-        if (_right_click_callback and _right_button_listener.clicked()) {
+        if (_right_click_callback and frame.right_button.clicked) {
             _right_click_callback();
         }
 
-        _joystick_listener.poll(now);
-        if (_direction_callback and (_joystick_listener.direction() != JoystickListener::Direction::Home) and _joystick_listener.changed()) {
-            _direction_callback(_joystick_listener.direction());
+        _direction_listener.update(frame.right_joystick, frame.timestamp);
+        if (_direction_callback and (_direction_listener.direction() != DirectionListener::Direction::Home) and _direction_listener.changed()) {
+            _direction_callback(_direction_listener.direction());
         }
     }
+
+private:
+    DirectionListener _direction_listener;
+    DirectionCallback _direction_callback{};
+
+    ClickCallback _left_click_callback{};
+    ClickCallback _right_click_callback{};
 };
 
-}// namespace djc
\ No newline at end of file
+}// namespace djc
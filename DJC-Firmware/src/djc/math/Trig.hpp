@@ -0,0 +1,125 @@
+// Copyright (c) 2026 KiraFlux
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#pragma once
+
+#include <kf/aliases.hpp>
+#include <kf/memory/Array.hpp>
+
+namespace djc::math {
+
+/// @brief Binary angle: full turn is 65536, wraps naturally
+using Angle = kf::i16;
+
+/// @brief Q14 fixed point: 1.0 is 16384
+using Q14 = kf::i32;
+
+static constexpr Q14 q14_one{1 << 14};
+static constexpr kf::i32 quarter_turn{1 << 14};
+
+namespace internal {
+
+// sin(i / 64 * 90 deg) in Q14
+static constexpr kf::memory::Array<kf::i16, 65> sine_table{{
+    0, 402, 804, 1205, 1606, 2006, 2404, 2801, 3196, 3590, 3981, 4370, 4756,
+    5139, 5520, 5897, 6270, 6639, 7005, 7366, 7723, 8076, 8423, 8765, 9102, 9434,
+    9760, 10080, 10394, 10702, 11003, 11297, 11585, 11866, 12140, 12406, 12665, 12916, 13160,
+    13395, 13623, 13842, 14053, 14256, 14449, 14635, 14811, 14978, 15137, 15286, 15426, 15557,
+    15679, 15791, 15893, 15986, 16069, 16143, 16207, 16261, 16305, 16340, 16364, 16379, 16384,
+}};
+
+// atan(i / 64) as binary angle
+static constexpr kf::memory::Array<kf::i16, 65> arctangent_table{{
+    0, 163, 326, 489, 651, 813, 975, 1136, 1297, 1457, 1617, 1775, 1933,
+    2090, 2246, 2401, 2555, 2708, 2860, 3010, 3159, 3307, 3453, 3599, 3742, 3884,
+    4025, 4164, 4302, 4438, 4572, 4705, 4836, 4966, 5094, 5220, 5344, 5467, 5589,
+    5708, 5826, 5943, 6058, 6171, 6282, 6392, 6500, 6607, 6712, 6815, 6917, 7018,
+    7117, 7214, 7310, 7405, 7498, 7589, 7679, 7768, 7856, 7942, 8026, 8110, 8192,
+}};
+
+/// @brief Linear interpolation in a 65-entry table over [0; 16384]
+constexpr kf::i32 lookup(const kf::memory::Array<kf::i16, 65> &table, kf::i32 position) noexcept {
+    const auto index = position >> 8;
+    const auto fraction = position & 0xFF;
+
+    if (index >= 64) { return table[64]; }
+
+    return table[index] + (((table[index + 1] - table[index]) * fraction) >> 8);
+}
+
+}// namespace internal
+
+/// @return Q14
+constexpr Q14 sin(Angle angle) noexcept {
+    const auto turn = static_cast<kf::u16>(angle);
+    const auto quadrant = turn >> 14;
+    auto position = static_cast<kf::i32>(turn & 0x3FFF);
+
+    if (quadrant & 1) { position = quarter_turn - position; }
+
+    const auto value = internal::lookup(internal::sine_table, position);
+    return quadrant >= 2 ? -value : value;
+}
+
+/// @return Q14
+constexpr Q14 cos(Angle angle) noexcept {
+    return sin(static_cast<Angle>(angle + quarter_turn));
+}
+
+/// @brief Angle of (x, y) in any common scale
+constexpr Angle atan2(kf::i32 y, kf::i32 x) noexcept {
+    if (x == 0 and y == 0) { return 0; }
+
+    const kf::i64 ax = x < 0 ? -static_cast<kf::i64>(x) : x;
+    const kf::i64 ay = y < 0 ? -static_cast<kf::i64>(y) : y;
+
+    kf::i32 angle{0};
+    if (ay <= ax) {
+        angle = internal::lookup(internal::arctangent_table, static_cast<kf::i32>((ay << 14) / ax));
+    } else {
+        angle = quarter_turn - internal::lookup(internal::arctangent_table, static_cast<kf::i32>((ax << 14) / ay));
+    }
+
+    if (x < 0) { angle = 2 * quarter_turn - angle; }
+    if (y < 0) { angle = -angle; }
+
+    return static_cast<Angle>(angle);
+}
+
+constexpr kf::u32 sqrt(kf::u32 value) noexcept {
+    kf::u32 root{0};
+    kf::u32 bit{1u << 30};
+
+    while (bit > value) { bit >>= 2; }
+
+    while (bit != 0) {
+        if (value >= root + bit) {
+            value -= root + bit;
+            root = (root >> 1) + bit;
+        } else {
+            root >>= 1;
+        }
+        bit >>= 2;
+    }
+
+    return root;
+}
+
+/// @param value Q14, clamped to [-1; 1]
+constexpr Angle asin(Q14 value) noexcept {
+    if (value > q14_one) { value = q14_one; }
+    if (value < -q14_one) { value = -q14_one; }
+
+    const auto cosine = static_cast<kf::i32>(sqrt(static_cast<kf::u32>(q14_one * q14_one - value * value)));
+    return atan2(value, cosine);
+}
+
+/// @brief Whole degrees of an angle
+constexpr kf::i32 degrees(Angle angle) noexcept {
+    return (static_cast<kf::i32>(angle) * 360) / 65536;
+}
+
+static_assert(sin(0) == 0 and sin(quarter_turn) == q14_one and cos(0) == q14_one);
+static_assert(atan2(1, 1) == quarter_turn / 2 and atan2(0, -1) == static_cast<Angle>(2 * quarter_turn));
+
+}// namespace djc::math
@@ -7,15 +7,29 @@
 
 namespace djc::memory {
 
+/// @brief Up to N items kept in insertion order, one of them selected
+/// @note Stored in NVS config as is: helpers only, the layout must not change
 template<typename T, typename Index, Index N> struct Box {
     kf::memory::Array<T, N> items;
     Index items_saved, selected_index;// 0..N
 
     constexpr Index maxItems() const noexcept { return N; }
 
+    constexpr Index size() const noexcept { return items_saved; }
+
+    constexpr bool full() const noexcept { return items_saved >= N; }
+
     const T &selected() const noexcept { return items[selected_index]; }
 
-    bool add(const T &item) noexcept {
+    constexpr T *begin() noexcept { return items.data(); }
+
+    constexpr T *end() noexcept { return items.data() + items_saved; }
+
+    constexpr const T *begin() const noexcept { return items.data(); }
+
+    constexpr const T *end() const noexcept { return items.data() + items_saved; }
+
+    constexpr bool add(const T &item) noexcept {
         if (items_saved >= maxItems()) { return false; }
 
         items[items_saved] = item;
@@ -24,6 +38,39 @@ template<typename T, typename Index, Index N> struct Box {
         return true;
     }
 
+    /// @brief First item matching a predicate
+    /// @return nullptr if none
+    template<typename P> constexpr T *findIf(P &&predicate) noexcept {
+        for (auto &item: *this) {
+            if (predicate(item)) { return &item; }
+        }
+        return nullptr;
+    }
+
+    template<typename P> constexpr const T *findIf(P &&predicate) const noexcept {
+        for (const auto &item: *this) {
+            if (predicate(item)) { return &item; }
+        }
+        return nullptr;
+    }
+
+    /// @brief Remove an item keeping the order, selection follows its item
+    constexpr bool remove(Index index) noexcept {
+        if (index >= items_saved) { return false; }
+
+        for (auto i = static_cast<Index>(index + 1); i < items_saved; i += 1) {
+            items[i - 1] = items[i];
+        }
+        items_saved -= 1;
+
+        if (selected_index > index) { selected_index -= 1; }
+        if (selected_index >= items_saved) { selected_index = 0; }
+
+        return true;
+    }
+
+    constexpr bool remove(const T *item) noexcept { return remove(static_cast<Index>(item - items.data())); }
+
     static constexpr Box defaults() noexcept {
         return Box{
             .items = {},
@@ -0,0 +1,162 @@
+// Copyright (c) 2026 KiraFlux
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#pragma once
+
+#include <atomic>
+#include <cstring>
+
+#include <Arduino.h>// for micros, FreeRTOS
+
+#include <kf/Logger.hpp>
+#include <kf/Option.hpp>
+#include <kf/aliases.hpp>
+#include <kf/memory/Array.hpp>
+#include <kf/mixin/Initable.hpp>
+#include <kf/mixin/NonCopyable.hpp>
+
+#include "djc/memory/SectionedStorage.hpp"
+
+namespace djc::memory {
+
+/// @brief Writes section snapshots to NVS from a low priority background task, so the main loop never waits for flash
+/// @note Payloads are copied on add(): RAM may change while the commit runs
+struct CommitTask final : kf::mixin::NonCopyable, kf::mixin::Initable<CommitTask, bool> {
+
+    static constexpr kf::u8 max_writes{8};
+    static constexpr kf::usize staging_size{1024};
+
+    /// @brief Finished commit
+    struct Result {
+        kf::u8 written, failed;
+        kf::u32 duration_us;
+    };
+
+    explicit CommitTask(const SectionedStorage &storage) noexcept :
+        _storage{storage} {}
+
+    /// @brief Previous commit is still being written
+    [[nodiscard]] bool busy() const noexcept { return _busy.load(std::memory_order_acquire); }
+
+    /// @brief Commits started so far: a change between two looks means one ran in between, even if already done
+    [[nodiscard]] kf::u32 started() const noexcept { return _started.load(std::memory_order_acquire); }
+
+    /// @brief Queue a write with a snapshot of its payload
+    /// @return false if no room is left, the write is not queued
+    bool add(const SectionedStorage::Write &write) noexcept {
+        if (_finished) {
+            _writes_total = 0;
+            _staged = 0;
+            _finished = false;
+        }
+
+        if (_writes_total == max_writes or _staged + write.size > staging_size) { return false; }
+
+        std::memcpy(_staging + _staged, write.payload, write.size);
+
+        _writes[_writes_total] = write;
+        _writes[_writes_total].payload = _staging + _staged;
+        _succeeded[_writes_total] = false;
+
+        _staged += write.size;
+        _writes_total += 1;
+        return true;
+    }
+
+    /// @brief Start writing queued sections
+    /// @note Writes in place when the task could not be started
+    void submit() noexcept {
+        _busy.store(true, std::memory_order_release);
+
+        if (_task == nullptr) {
+            commit();
+            return;
+        }
+
+        xTaskNotifyGive(_task);
+    }
+
+    /// @brief Result of the last finished commit, once. Writes stay readable until the next add()
+    [[nodiscard]] kf::Option<Result> takeResult() noexcept {
+        if (not _done.exchange(false, std::memory_order_acquire)) { return {}; }
+
+        _finished = true;
+        return {_result};
+    }
+
+    [[nodiscard]] kf::u8 writesTotal() const noexcept { return _writes_total; }
+
+    [[nodiscard]] const SectionedStorage::Write &write(kf::u8 index) const noexcept { return _writes[index]; }
+
+    [[nodiscard]] bool succeeded(kf::u8 index) const noexcept { return _succeeded[index]; }
+
+private:
+    static constexpr auto logger{kf::Logger::create("CommitTask")};
+
+    static constexpr kf::u32 stack_size{4096};
+    static constexpr UBaseType_t priority{1};// below display flush
+    static constexpr BaseType_t core{0};     // main loop runs on core 1
+
+    const SectionedStorage &_storage;
+    TaskHandle_t _task{nullptr};
+
+    kf::memory::Array<SectionedStorage::Write, max_writes> _writes{};
+    kf::memory::Array<bool, max_writes> _succeeded{};
+    kf::u8 _writes_total{0};
+    kf::u8 _staging[staging_size]{};
+    kf::usize _staged{0};
+    bool _finished{false};// writes belong to a taken result
+
+    Result _result{};
+    std::atomic<bool> _busy{false};
+    std::atomic<bool> _done{false};
+    std::atomic<kf::u32> _started{0};
+
+    void commit() noexcept {
+        _started.fetch_add(1, std::memory_order_release);
+        const auto start = micros();
+        Result result{};
+
+        for (kf::u8 i = 0; i < _writes_total; i += 1) {
+            _succeeded[i] = _storage.write(_writes[i]);
+
+            if (_succeeded[i]) {
+                result.written += 1;
+            } else {
+                result.failed += 1;
+            }
+        }
+
+        result.duration_us = static_cast<kf::u32>(micros() - start);
+        _result = result;
+
+        _done.store(true, std::memory_order_release);
+        _busy.store(false, std::memory_order_release);
+    }
+
+    [[noreturn]] static void taskEntry(void *self) noexcept {
+        auto &commit_task = *static_cast<CommitTask *>(self);
+
+        while (true) {
+            (void) ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+            commit_task.commit();
+        }
+    }
+
+    // impl
+
+    KF_IMPL_INITABLE(CommitTask, bool);
+    bool initImpl() noexcept {
+        const auto created = xTaskCreatePinnedToCore(taskEntry, "djc-commit", stack_size, this, priority, &_task, core);
+
+        if (created != pdPASS) {
+            _task = nullptr;
+            logger.error("task not created, committing synchronously");
+            return false;
+        }
+
+        return true;
+    }
+};
+
+}// namespace djc::memory
@@ -0,0 +1,24 @@
+// Copyright (c) 2026 KiraFlux
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#pragma once
+
+#include <kf/aliases.hpp>
+
+namespace djc::memory {
+
+/// @brief CRC-32 (IEEE 802.3), bitwise: meant for config-sized blocks
+constexpr kf::u32 crc32(const kf::u8 *data, kf::usize size) noexcept {
+    kf::u32 crc{0xFFFFFFFFu};
+
+    for (kf::usize i = 0; i < size; i += 1) {
+        crc ^= data[i];
+        for (kf::u8 bit = 0; bit < 8; bit += 1) {
+            crc = (crc >> 1) ^ (0xEDB88320u & (0u - (crc & 1u)));
+        }
+    }
+
+    return ~crc;
+}
+
+}// namespace djc::memory
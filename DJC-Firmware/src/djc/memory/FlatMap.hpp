@@ -0,0 +1,109 @@
+// Copyright (c) 2026 KiraFlux
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#pragma once
+
+#include <kf/aliases.hpp>
+#include <kf/memory/Array.hpp>
+
+namespace djc::memory {
+
+/// @brief Fixed capacity map on sorted arrays
+/// @details Lookup is a binary search; insert and erase shift the tail. No heap, trivially copyable
+/// when K and V are, so it can be part of NVS config (the layout is keys, values, count)
+template<typename K, typename V, kf::u16 N> struct FlatMap {
+    kf::memory::Array<K, N> keys;
+    kf::memory::Array<V, N> values;
+    kf::u16 count;
+
+    static constexpr kf::u16 capacity() noexcept { return N; }
+
+    constexpr kf::u16 size() const noexcept { return count; }
+
+    constexpr bool empty() const noexcept { return count == 0; }
+
+    constexpr bool full() const noexcept { return count == N; }
+
+    constexpr const K &keyAt(kf::u16 index) const noexcept { return keys[index]; }
+
+    constexpr V &valueAt(kf::u16 index) noexcept { return values[index]; }
+
+    constexpr const V &valueAt(kf::u16 index) const noexcept { return values[index]; }
+
+    /// @return nullptr if absent
+    constexpr V *find(const K &key) noexcept {
+        const auto index = lowerBound(key);
+        return index < count and keys[index] == key ? &values[index] : nullptr;
+    }
+
+    constexpr const V *find(const K &key) const noexcept {
+        const auto index = lowerBound(key);
+        return index < count and keys[index] == key ? &values[index] : nullptr;
+    }
+
+    constexpr bool contains(const K &key) const noexcept { return find(key) != nullptr; }
+
+    /// @brief Insert or overwrite
+    /// @return Stored value, nullptr if the key is new and the map is full
+    constexpr V *insert(const K &key, const V &value) noexcept {
+        const auto index = lowerBound(key);
+
+        if (index < count and keys[index] == key) {
+            values[index] = value;
+            return &values[index];
+        }
+
+        if (full()) { return nullptr; }
+
+        for (auto i = count; i > index; i -= 1) {
+            keys[i] = keys[i - 1];
+            values[i] = values[i - 1];
+        }
+
+        keys[index] = key;
+        values[index] = value;
+        count += 1;
+        return &values[index];
+    }
+
+    constexpr bool erase(const K &key) noexcept {
+        const auto index = lowerBound(key);
+        if (index == count or not(keys[index] == key)) { return false; }
+
+        for (auto i = static_cast<kf::u16>(index + 1); i < count; i += 1) {
+            keys[i - 1] = keys[i];
+            values[i - 1] = values[i];
+        }
+        count -= 1;
+        return true;
+    }
+
+    constexpr void clear() noexcept { count = 0; }
+
+    static constexpr FlatMap defaults() noexcept {
+        return FlatMap{
+            .keys = {},
+            .values = {},
+            .count = 0,
+        };
+    }
+
+private:
+    /// @brief First index with a key not less than the given one
+    constexpr kf::u16 lowerBound(const K &key) const noexcept {
+        kf::u16 low{0}, high{count};
+
+        while (low < high) {
+            const auto middle = static_cast<kf::u16>(low + (high - low) / 2);
+            if (keys[middle] < key) {
+                low = middle + 1;
+            } else {
+                high = middle;
+            }
+        }
+
+        return low;
+    }
+};
+
+}// namespace djc::memory
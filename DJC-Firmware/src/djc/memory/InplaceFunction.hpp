@@ -0,0 +1,93 @@
+// Copyright (c) 2026 KiraFlux
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#pragma once
+
+#include <cstddef>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+#include <kf/aliases.hpp>
+
+namespace djc::memory {
+
+template<typename Signature, kf::usize Capacity = 3 * sizeof(void *)> struct InplaceFunction;
+
+/// @brief Move-only callable stored in a fixed buffer inside the object
+/// @details Never allocates: a callable larger than the buffer is a compile error, not a heap fallback.
+/// Setting or moving callbacks (page entry and exit) is therefore free of heap traffic
+template<typename R, typename... Args, kf::usize Capacity> struct InplaceFunction<R(Args...), Capacity> {
+
+    constexpr InplaceFunction() noexcept = default;
+
+    constexpr InplaceFunction(std::nullptr_t) noexcept {}
+
+    template<typename F, typename = std::enable_if_t<not std::is_same_v<std::decay_t<F>, InplaceFunction> and std::is_invocable_r_v<R, std::decay_t<F> &, Args...>>>
+    InplaceFunction(F &&callable) noexcept {
+        using Callable = std::decay_t<F>;
+        static_assert(sizeof(Callable) <= Capacity, "callable does not fit: capture less or raise the capacity");
+        static_assert(alignof(Callable) <= alignof(std::max_align_t));
+        static_assert(std::is_nothrow_move_constructible_v<Callable>);
+
+        new (_storage) Callable(std::forward<F>(callable));
+        _ops = &ops<Callable>;
+    }
+
+    InplaceFunction(InplaceFunction &&other) noexcept { take(other); }
+
+    InplaceFunction &operator=(InplaceFunction &&other) noexcept {
+        if (this != &other) {
+            reset();
+            take(other);
+        }
+        return *this;
+    }
+
+    InplaceFunction &operator=(std::nullptr_t) noexcept {
+        reset();
+        return *this;
+    }
+
+    InplaceFunction(const InplaceFunction &) = delete;
+    InplaceFunction &operator=(const InplaceFunction &) = delete;
+
+    ~InplaceFunction() noexcept { reset(); }
+
+    explicit operator bool() const noexcept { return _ops != nullptr; }
+
+    R operator()(Args... args) const { return _ops->invoke(_storage, std::forward<Args>(args)...); }
+
+private:
+    struct Ops {
+        R (*invoke)(void *, Args &&...);
+        void (*move)(void *destination, void *source);
+        void (*destroy)(void *);
+    };
+
+    template<typename Callable> static constexpr Ops ops{
+        [](void *self, Args &&...args) -> R { return (*static_cast<Callable *>(self))(std::forward<Args>(args)...); },
+        [](void *destination, void *source) { new (destination) Callable(std::move(*static_cast<Callable *>(source))); },
+        [](void *self) { static_cast<Callable *>(self)->~Callable(); },
+    };
+
+    alignas(std::max_align_t) mutable kf::u8 _storage[Capacity]{};
+    const Ops *_ops{nullptr};
+
+    void take(InplaceFunction &other) noexcept {
+        if (other._ops == nullptr) { return; }
+
+        other._ops->move(_storage, other._storage);
+        _ops = other._ops;
+        other.reset();
+    }
+
+    void reset() noexcept {
+        if (_ops == nullptr) { return; }
+
+        _ops->destroy(_storage);
+        _ops = nullptr;
+    }
+};
+
+}// namespace djc::memory
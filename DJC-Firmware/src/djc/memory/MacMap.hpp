@@ -0,0 +1,143 @@
+// Copyright (c) 2026 KiraFlux
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#pragma once
+
+#include <kf/aliases.hpp>
+#include <kf/memory/Array.hpp>
+
+#include "djc/prelude.hpp"
+
+namespace djc::memory {
+
+/// @brief Open addressing hash map keyed by ESP-NOW MAC address
+/// @details Linear probing over N buckets (power of two); erase shifts the following entries back,
+/// so there are no tombstones and lookups stay short under churn. No heap, trivially copyable when V is.
+/// Keep it at most 3/4 full: insert refuses beyond that
+template<typename V, kf::u16 N> struct MacMap {
+    static_assert(N > 0 and (N & (N - 1)) == 0, "bucket count must be a power of two");
+
+    using Mac = EspNow::Mac;
+
+    static constexpr kf::u16 capacity() noexcept { return N - N / 4; }
+
+    kf::memory::Array<Mac, N> keys;
+    kf::memory::Array<V, N> values;
+    kf::memory::Array<bool, N> used;
+    kf::u16 count;
+
+    constexpr kf::u16 size() const noexcept { return count; }
+
+    constexpr bool empty() const noexcept { return count == 0; }
+
+    /// @return nullptr if absent
+    constexpr V *find(const Mac &mac) noexcept {
+        const auto bucket = lookup(mac);
+        return bucket == N ? nullptr : &values[bucket];
+    }
+
+    constexpr const V *find(const Mac &mac) const noexcept {
+        const auto bucket = lookup(mac);
+        return bucket == N ? nullptr : &values[bucket];
+    }
+
+    constexpr bool contains(const Mac &mac) const noexcept { return lookup(mac) != N; }
+
+    /// @brief Insert or overwrite
+    /// @return Stored value, nullptr if the key is new and the map is at capacity
+    constexpr V *insert(const Mac &mac, const V &value) noexcept {
+        auto bucket = home(mac);
+
+        while (used[bucket]) {
+            if (same(keys[bucket], mac)) {
+                values[bucket] = value;
+                return &values[bucket];
+            }
+            bucket = (bucket + 1) & mask;
+        }
+
+        if (count >= capacity()) { return nullptr; }
+
+        keys[bucket] = mac;
+        values[bucket] = value;
+        used[bucket] = true;
+        count += 1;
+        return &values[bucket];
+    }
+
+    constexpr bool erase(const Mac &mac) noexcept {
+        auto hole = lookup(mac);
+        if (hole == N) { return false; }
+
+        // Move back entries whose probe run crosses the hole
+        auto bucket = (hole + 1) & mask;
+        while (used[bucket]) {
+            const auto wanted = home(keys[bucket]);
+            if (((bucket - wanted) & mask) >= ((bucket - hole) & mask)) {
+                keys[hole] = keys[bucket];
+                values[hole] = values[bucket];
+                hole = bucket;
+            }
+            bucket = (bucket + 1) & mask;
+        }
+
+        used[hole] = false;
+        count -= 1;
+        return true;
+    }
+
+    constexpr void clear() noexcept {
+        for (auto &bucket: used) { bucket = false; }
+        count = 0;
+    }
+
+    /// @brief Visit every entry as (mac, value)
+    template<typename F> constexpr void forEach(F &&visit) const noexcept {
+        for (kf::u16 i = 0; i < N; i += 1) {
+            if (used[i]) { visit(keys[i], values[i]); }
+        }
+    }
+
+    static constexpr MacMap defaults() noexcept {
+        return MacMap{
+            .keys = {},
+            .values = {},
+            .used = {},
+            .count = 0,
+        };
+    }
+
+private:
+    static constexpr kf::u16 mask{N - 1};
+
+    /// @brief FNV-1a of the address
+    static constexpr kf::u16 home(const Mac &mac) noexcept {
+        kf::u32 hash{2166136261u};
+        for (kf::usize i = 0; i < mac.size(); i += 1) {
+            hash = (hash ^ mac[i]) * 16777619u;
+        }
+        return static_cast<kf::u16>((hash ^ (hash >> 16)) & mask);
+    }
+
+    /// @brief Element-wise, usable in constant expressions
+    static constexpr bool same(const Mac &a, const Mac &b) noexcept {
+        for (kf::usize i = 0; i < a.size(); i += 1) {
+            if (a[i] != b[i]) { return false; }
+        }
+        return true;
+    }
+
+    /// @return Bucket of the key, N if absent
+    constexpr kf::u16 lookup(const Mac &mac) const noexcept {
+        auto bucket = home(mac);
+
+        while (used[bucket]) {
+            if (same(keys[bucket], mac)) { return bucket; }
+            bucket = (bucket + 1) & mask;
+        }
+
+        return N;
+    }
+};
+
+}// namespace djc::memory
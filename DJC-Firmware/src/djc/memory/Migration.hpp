@@ -0,0 +1,76 @@
+// Copyright (c) 2026 KiraFlux
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#pragma once
+
+#include <cstring>
+
+#include <kf/aliases.hpp>
+#include <kf/memory/Slice.hpp>
+
+namespace djc::memory {
+
+/// @brief Field placement in a stored layout
+/// @details Field ids stay the same across versions of a section; a field keeps its id while its meaning is kept
+struct FieldLayout {
+    kf::u8 id;
+    kf::u16 offset;
+    kf::u16 size;
+};
+
+template<typename Id> constexpr FieldLayout field(Id id, kf::usize offset, kf::usize size) noexcept {
+    return FieldLayout{
+        .id = static_cast<kf::u8>(id),
+        .offset = static_cast<kf::u16>(offset),
+        .size = static_cast<kf::u16>(size),
+    };
+}
+
+/// @brief Stored layout of one section version
+struct SectionLayout {
+    using Fixup = void (*)(kf::u8 *data);
+
+    kf::u16 version;
+    kf::u16 size;
+    kf::memory::Slice<const FieldLayout> fields;
+    Fixup fixup;// semantic change made by this version, applied to upgraded data. May be null
+};
+
+/// @brief Upgrade a stored payload to the newest layout of a chain
+/// @details Fields found in both layouts with the same id and size are copied, other fields keep what `data` holds
+/// (defaults). Then fixups of every newer version run in order
+/// @param chain Section layouts, oldest first, the last one is the RAM layout
+/// @param data Current layout defaults, receives the result
+/// @return Payload version is known and its size matches
+inline bool migrate(kf::memory::Slice<const SectionLayout> chain, kf::u16 version, const kf::u8 *payload, kf::usize size, kf::u8 *data) noexcept {
+    if (chain.size() == 0) { return false; }
+
+    kf::usize from_index{0};
+    while (from_index < chain.size() and chain.data()[from_index].version != version) { from_index += 1; }
+
+    if (from_index == chain.size()) { return false; }
+
+    const auto &from = chain.data()[from_index];
+    const auto &to = chain.data()[chain.size() - 1];
+    if (from.size != size) { return false; }
+
+    for (kf::usize i = 0; i < to.fields.size(); i += 1) {
+        const auto &target = to.fields.data()[i];
+
+        for (kf::usize j = 0; j < from.fields.size(); j += 1) {
+            const auto &source = from.fields.data()[j];
+            if (source.id != target.id or source.size != target.size) { continue; }
+
+            std::memcpy(data + target.offset, payload + source.offset, target.size);
+            break;
+        }
+    }
+
+    for (auto i = from_index + 1; i < chain.size(); i += 1) {
+        if (chain.data()[i].fixup != nullptr) { chain.data()[i].fixup(data); }
+    }
+
+    return true;
+}
+
+}// namespace djc::memory
@@ -0,0 +1,88 @@
+// Copyright (c) 2026 KiraFlux
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#pragma once
+
+#include <new>
+#include <utility>
+
+#include <kf/aliases.hpp>
+#include <kf/memory/Array.hpp>
+#include <kf/mixin/NonCopyable.hpp>
+
+namespace djc::memory {
+
+/// @brief Storage for up to N objects of T, created and destroyed in any order without heap
+/// @details Free slots form an intrusive index list: create and destroy are O(1)
+template<typename T, kf::u16 N> struct Pool final : kf::mixin::NonCopyable {
+    static_assert(N < 0xFFFF);
+
+    Pool() noexcept {
+        for (kf::u16 i = 0; i < N; i += 1) { _next[i] = static_cast<kf::u16>(i + 1); }
+    }
+
+    ~Pool() noexcept {
+        for (kf::u16 i = 0; i < N; i += 1) {
+            if (_alive[i]) { slot(i)->~T(); }
+        }
+    }
+
+    static constexpr kf::u16 capacity() noexcept { return N; }
+
+    [[nodiscard]] kf::u16 size() const noexcept { return _used; }
+
+    [[nodiscard]] bool full() const noexcept { return _free == none; }
+
+    /// @return nullptr if the pool is exhausted
+    template<typename... Args> T *create(Args &&...args) noexcept {
+        if (full()) { return nullptr; }
+
+        const auto index = _free;
+        _free = _next[index];
+        _alive[index] = true;
+        _used += 1;
+
+        return new (_storage[index].bytes) T{std::forward<Args>(args)...};
+    }
+
+    /// @brief Destroy an object made by this pool
+    void destroy(T *object) noexcept {
+        if (object == nullptr) { return; }
+
+        const auto index = indexOf(object);
+        if (index >= N or not _alive[index]) { return; }
+
+        object->~T();
+        _alive[index] = false;
+        _next[index] = _free;
+        _free = index;
+        _used -= 1;
+    }
+
+    /// @brief Slot index of an object, stable while it lives
+    [[nodiscard]] kf::u16 indexOf(const T *object) const noexcept {
+        const auto *bytes = reinterpret_cast<const kf::u8 *>(object);
+        const auto *first = _storage[0].bytes;
+        return static_cast<kf::u16>((bytes - first) / sizeof(Slot));
+    }
+
+    /// @return nullptr if the slot is free
+    [[nodiscard]] T *at(kf::u16 index) noexcept { return index < N and _alive[index] ? slot(index) : nullptr; }
+
+private:
+    static constexpr kf::u16 none{N};
+
+    struct Slot {
+        alignas(T) kf::u8 bytes[sizeof(T)];
+    };
+
+    kf::memory::Array<Slot, N> _storage{};
+    kf::memory::Array<kf::u16, N> _next{};
+    kf::memory::Array<bool, N> _alive{};
+    kf::u16 _free{0};
+    kf::u16 _used{0};
+
+    T *slot(kf::u16 index) noexcept { return std::launder(reinterpret_cast<T *>(_storage[index].bytes)); }
+};
+
+}// namespace djc::memory
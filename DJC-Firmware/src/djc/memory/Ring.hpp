@@ -0,0 +1,70 @@
+// Copyright (c) 2026 KiraFlux
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#pragma once
+
+#include <atomic>
+
+#include <kf/aliases.hpp>
+#include <kf/memory/Array.hpp>
+#include <kf/mixin/NonCopyable.hpp>
+
+namespace djc::memory {
+
+/// @brief Lock-free ring buffer for one producer and one consumer
+/// @details The producer owns the head, the consumer owns the tail; each index is written by one side only,
+/// so a radio callback can feed the main loop without a critical section. Holds N - 1 items (N is a power of two)
+template<typename T, kf::u16 N> struct Ring final : kf::mixin::NonCopyable {
+    static_assert(N > 1 and (N & (N - 1)) == 0, "size must be a power of two");
+
+    static constexpr kf::u16 capacity() noexcept { return N - 1; }
+
+    /// @brief Producer side
+    /// @return false if full, the item is dropped
+    bool push(const T &item) noexcept {
+        const auto head = _head.load(std::memory_order_relaxed);
+        const auto next = static_cast<kf::u16>((head + 1) & mask);
+
+        if (next == _tail.load(std::memory_order_acquire)) {
+            _dropped.fetch_add(1, std::memory_order_relaxed);
+            return false;
+        }
+
+        _items[head] = item;
+        _head.store(next, std::memory_order_release);
+        return true;
+    }
+
+    /// @brief Consumer side
+    /// @return false if empty
+    bool pop(T &item) noexcept {
+        const auto tail = _tail.load(std::memory_order_relaxed);
+        if (tail == _head.load(std::memory_order_acquire)) { return false; }
+
+        item = _items[tail];
+        _tail.store(static_cast<kf::u16>((tail + 1) & mask), std::memory_order_release);
+        return true;
+    }
+
+    [[nodiscard]] bool empty() const noexcept {
+        return _head.load(std::memory_order_acquire) == _tail.load(std::memory_order_acquire);
+    }
+
+    /// @brief Approximate while the other side runs
+    [[nodiscard]] kf::u16 size() const noexcept {
+        return static_cast<kf::u16>((_head.load(std::memory_order_acquire) - _tail.load(std::memory_order_acquire)) & mask);
+    }
+
+    /// @brief Items refused because the ring was full
+    [[nodiscard]] kf::u32 dropped() const noexcept { return _dropped.load(std::memory_order_relaxed); }
+
+private:
+    static constexpr kf::u16 mask{N - 1};
+
+    kf::memory::Array<T, N> _items{};
+    std::atomic<kf::u16> _head{0};
+    std::atomic<kf::u16> _tail{0};
+    std::atomic<kf::u32> _dropped{0};
+};
+
+}// namespace djc::memory
@@ -0,0 +1,224 @@
+// Copyright (c) 2026 KiraFlux
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#pragma once
+
+#include <cstring>
+
+#include <Preferences.h>
+
+#include <kf/aliases.hpp>
+#include <kf/memory/ArrayString.hpp>
+#include <kf/mixin/NonCopyable.hpp>
+
+#include "djc/memory/Crc32.hpp"
+
+namespace djc::memory {
+
+/// @brief Part of a RAM structure stored under its own NVS keys
+struct StorageSection {
+    const char *key;// up to 13 characters, slot suffix is appended
+    kf::u16 version;
+    void *data;
+    kf::u16 size;
+
+    // NVS state
+    kf::u32 stored_crc;// payload CRC of the newest entry, 0 while unknown
+    kf::u32 sequence;  // of the newest entry
+    kf::u8 slot;       // holding the newest entry
+
+    [[nodiscard]] kf::u32 crc() const noexcept { return crc32(static_cast<const kf::u8 *>(data), size); }
+
+    /// @brief RAM differs from NVS
+    [[nodiscard]] bool dirty() const noexcept { return crc() != stored_crc; }
+};
+
+/// @brief NVS namespace of sections, each written alone and validated alone
+/// @details Every section has two slots (A/B) written in turn: the newest valid slot wins on load,
+/// so a write interrupted by power loss leaves the previous entry in place.
+/// Entry layout: version, payload size, sequence, payload CRC-32, payload
+struct SectionedStorage final : kf::mixin::NonCopyable {
+
+    static constexpr kf::usize max_section_size{512};
+
+    enum class LoadResult : kf::u8 {
+        Ok,
+        Missing,
+        Outdated,// other version, the entry is left in the buffer
+        Corrupted,
+    };
+
+    /// @brief Entry read by the last load
+    struct Entry {
+        kf::u16 version;
+        const kf::u8 *payload;
+        kf::u16 size;
+    };
+
+    /// @brief Prepared slot write, independent of the section: may run in another task
+    struct Write {
+        const char *key;
+        kf::u16 version;
+        kf::u16 size;
+        kf::u32 sequence;
+        kf::u32 crc;
+        kf::u8 slot;
+        const kf::u8 *payload;
+    };
+
+    explicit SectionedStorage(const char *name_space) noexcept :
+        _name_space{name_space} {}
+
+    [[nodiscard]] static const char *stringFromLoadResult(LoadResult result) noexcept {
+        switch (result) {
+            case LoadResult::Ok: return "ok";
+            case LoadResult::Missing: return "missing";
+            case LoadResult::Outdated: return "outdated";
+            case LoadResult::Corrupted: return "corrupted";
+        }
+        return "?";
+    }
+
+    /// @brief Valid after a load that returned Ok or Outdated, until the next load
+    [[nodiscard]] Entry lastEntry() const noexcept {
+        const auto header = headerOf(_buffer);
+        return Entry{.version = header.version, .payload = _buffer + sizeof(Header), .size = header.size};
+    }
+
+    /// @brief Read the newest valid slot
+    LoadResult load(StorageSection &section) noexcept {
+        Preferences preferences;
+        if (not preferences.begin(_name_space, true)) { return LoadResult::Missing; }
+
+        kf::u8 valid{0}, corrupted{0};
+        kf::u8 newest_slot{0};
+        kf::u32 newest_sequence{0};
+
+        for (kf::u8 slot = 0; slot < slots_total; slot += 1) {
+            const auto result = readSlot(preferences, section.key, slot);
+
+            if (result == LoadResult::Corrupted) { corrupted += 1; }
+            if (result != LoadResult::Ok) { continue; }
+
+            const auto sequence = headerOf(_buffer).sequence;
+            if (valid == 0 or sequence > newest_sequence) {
+                newest_slot = slot;
+                newest_sequence = sequence;
+            }
+            valid += 1;
+        }
+
+        if (valid == 0) {
+            preferences.end();
+            return corrupted == 0 ? LoadResult::Missing : LoadResult::Corrupted;
+        }
+
+        // Buffer holds the last slot read
+        (void) readSlot(preferences, section.key, newest_slot);
+        preferences.end();
+
+        const auto header = headerOf(_buffer);
+        section.sequence = header.sequence;
+        section.slot = newest_slot;
+
+        if (header.version != section.version) { return LoadResult::Outdated; }
+        if (header.size != section.size) { return LoadResult::Corrupted; }
+
+        std::memcpy(section.data, _buffer + sizeof(Header), section.size);
+        section.stored_crc = header.crc;
+        return LoadResult::Ok;
+    }
+
+    /// @brief Write of given payload snapshot into the slot after the newest
+    [[nodiscard]] static Write prepare(const StorageSection &section, const kf::u8 *payload) noexcept {
+        return Write{
+            .key = section.key,
+            .version = section.version,
+            .size = section.size,
+            .sequence = section.sequence + 1,
+            .crc = crc32(payload, section.size),
+            .slot = static_cast<kf::u8>((section.slot + 1) % slots_total),
+            .payload = payload,
+        };
+    }
+
+    /// @note Uses no shared state: safe to call from a background task
+    bool write(const Write &write) const noexcept {
+        kf::u8 buffer[sizeof(Header) + max_section_size];
+
+        const Header header{
+            .version = write.version,
+            .size = write.size,
+            .sequence = write.sequence,
+            .crc = write.crc,
+        };
+        std::memcpy(buffer, &header, sizeof(Header));
+        std::memcpy(buffer + sizeof(Header), write.payload, write.size);
+
+        Preferences preferences;
+        if (not preferences.begin(_name_space, false)) { return false; }
+
+        const auto length = sizeof(Header) + write.size;
+        const auto written = preferences.putBytes(slotKey(write.key, write.slot).data(), buffer, length);
+        preferences.end();
+
+        return written == length;
+    }
+
+    /// @brief Record a successful write
+    static void committed(StorageSection &section, const Write &write) noexcept {
+        section.stored_crc = write.crc;
+        section.sequence = write.sequence;
+        section.slot = write.slot;
+    }
+
+    /// @brief Write RAM content in place
+    bool save(StorageSection &section) noexcept {
+        const auto prepared = prepare(section, static_cast<const kf::u8 *>(section.data));
+        if (not write(prepared)) { return false; }
+
+        committed(section, prepared);
+        return true;
+    }
+
+private:
+    static constexpr kf::u8 slots_total{2};
+
+    struct Header {
+        kf::u16 version;
+        kf::u16 size;
+        kf::u32 sequence;
+        kf::u32 crc;
+    };
+
+    const char *_name_space;
+    kf::u8 _buffer[sizeof(Header) + max_section_size]{};
+
+    [[nodiscard]] static Header headerOf(const kf::u8 *entry) noexcept {
+        Header header;
+        std::memcpy(&header, entry, sizeof(Header));
+        return header;
+    }
+
+    [[nodiscard]] static kf::memory::ArrayString<16> slotKey(const char *key, kf::u8 slot) noexcept {
+        return kf::memory::ArrayString<16>::formatted("%s.%c", key, 'a' + slot);
+    }
+
+    /// @brief Read and check a slot into the buffer
+    LoadResult readSlot(Preferences &preferences, const char *key, kf::u8 slot) noexcept {
+        const auto slot_key = slotKey(key, slot);
+
+        const auto length = preferences.getBytesLength(slot_key.data());
+        if (length == 0) { return LoadResult::Missing; }
+        if (length < sizeof(Header) or length > sizeof(_buffer)) { return LoadResult::Corrupted; }
+
+        if (preferences.getBytes(slot_key.data(), _buffer, length) != length) { return LoadResult::Corrupted; }
+
+        const auto header = headerOf(_buffer);
+        if (header.size != length - sizeof(Header) or crc32(_buffer + sizeof(Header), header.size) != header.crc) { return LoadResult::Corrupted; }
+
+        return LoadResult::Ok;
+    }
+};
+
+}// namespace djc::memory
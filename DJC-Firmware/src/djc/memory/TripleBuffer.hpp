@@ -0,0 +1,46 @@
+// Copyright (c) 2026 KiraFlux
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#pragma once
+
+#include <atomic>
+
+#include <kf/aliases.hpp>
+#include <kf/memory/Array.hpp>
+#include <kf/mixin/NonCopyable.hpp>
+
+namespace djc::memory {
+
+/// @brief Latest value handed from one writer to one reader without locks or retries
+/// @details Three slots: the writer fills its back slot and swaps it with the middle one, the reader swaps the middle
+/// slot with its front one when something new was published. Neither side ever waits, and the reader always sees a
+/// complete value, the newest published one
+template<typename T> struct TripleBuffer final : kf::mixin::NonCopyable {
+
+    /// @brief Writer side
+    void write(const T &value) noexcept {
+        _slots[_back] = value;
+        const auto previous = _middle.exchange(static_cast<kf::u8>(_back | fresh), std::memory_order_acq_rel);
+        _back = previous & index_mask;
+    }
+
+    /// @brief Reader side: newest published value
+    [[nodiscard]] const T &read() noexcept {
+        if ((_middle.load(std::memory_order_relaxed) & fresh) != 0) {
+            const auto previous = _middle.exchange(_front, std::memory_order_acq_rel);
+            _front = previous & index_mask;
+        }
+        return _slots[_front];
+    }
+
+private:
+    static constexpr kf::u8 index_mask{0x03};
+    static constexpr kf::u8 fresh{0x04};
+
+    kf::memory::Array<T, 3> _slots{};
+    kf::u8 _back{0};              // writer only
+    kf::u8 _front{1};             // reader only
+    std::atomic<kf::u8> _middle{2};// index, fresh flag
+};
+
+}// namespace djc::memory
@@ -0,0 +1,94 @@
+// Copyright (c) 2026 KiraFlux
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#pragma once
+
+#include <kf/aliases.hpp>
+#include <kf/math/units.hpp>
+#include <kf/mixin/Singleton.hpp>
+
+#include "djc/ui/UI.hpp"
+
+namespace djc::ui {
+
+namespace internal {
+
+struct FramePacerConfig {
+    kf::math::Milliseconds frame_period;        // display refresh cap
+    kf::math::Milliseconds control_frame_period;// refresh cap while control is enabled
+
+    static constexpr FramePacerConfig defaults() noexcept {
+        return FramePacerConfig{
+            .frame_period = 1000 / 25,        // 25 FPS
+            .control_frame_period = 1000 / 5, // 5 FPS
+        };
+    }
+};
+
+}// namespace internal
+
+/// @brief Caps the display refresh rate: redraw requests are coalesced into at most one update event per frame period
+/// @note Request redraws through request() instead of raising UI::Event::update() directly
+struct FramePacer final : kf::mixin::Singleton<FramePacer> {
+    using Config = internal::FramePacerConfig;
+
+    struct Stats {
+        kf::u32 rendered;  // frames admitted
+        kf::u32 skipped;   // renders refused as too early, redrawn later
+        kf::u32 coalesced; // requests merged into an already pending frame
+    };
+
+    [[nodiscard]] Config &config() noexcept { return _config; }
+
+    [[nodiscard]] const Stats &stats() const noexcept { return _stats; }
+
+    /// @brief Ask for a redraw
+    void request() noexcept {
+        if (_pending) {
+            _stats.coalesced += 1;
+            return;
+        }
+        _pending = true;
+    }
+
+    /// @brief Decide whether a frame may be rendered now. A refused frame is redrawn when due
+    [[nodiscard]] bool admit(kf::math::Milliseconds now) noexcept {
+        if (_rendered_once and now - _last_frame < period()) {
+            _stats.skipped += 1;
+            _pending = true;
+            return false;
+        }
+
+        _rendered_once = true;
+        _last_frame = now;
+        _pending = false;
+        _stats.rendered += 1;
+        return true;
+    }
+
+    /// @param control_active Control path has priority: frames are paced by control_frame_period
+    void poll(kf::math::Milliseconds now, bool control_active) noexcept {
+        _control_active = control_active;
+
+        if (not _pending) { return; }
+        if (_rendered_once and now - _last_frame < period()) { return; }
+
+        _pending = false;
+        UI::instance().addEvent(UI::Event::update());
+    }
+
+private:
+    Config _config{Config::defaults()};
+    Stats _stats{};
+
+    kf::math::Milliseconds _last_frame{0};
+    bool _rendered_once{false};
+    bool _pending{false};
+    bool _control_active{false};
+
+    [[nodiscard]] kf::math::Milliseconds period() const noexcept {
+        return _control_active ? _config.control_frame_period : _config.frame_period;
+    }
+};
+
+}// namespace djc::ui
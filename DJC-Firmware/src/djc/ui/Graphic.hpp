@@ -0,0 +1,42 @@
+// Copyright (c) 2026 KiraFlux
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#pragma once
+
+#include <kf/aliases.hpp>
+#include <kf/mixin/Singleton.hpp>
+
+#include "djc/display/Painter.hpp"
+
+namespace djc::ui {
+
+/// @brief Pixel graphics shown below the text of a page
+struct Graphic {
+    virtual ~Graphic() = default;
+
+    /// @param full Area content is lost: draw everything. Otherwise draw only what changed since the previous call
+    virtual void draw(display::Painter &painter, bool full) noexcept = 0;
+};
+
+/// @brief Graphic of the current page, drawn by the display over the bottom text rows
+/// @note Pages show their graphic on entry and hide it on exit
+struct GraphicView final : kf::mixin::Singleton<GraphicView> {
+
+    /// @param rows Glyph rows taken from the bottom of the page text
+    void show(Graphic &graphic, kf::u8 rows) noexcept {
+        _graphic = &graphic;
+        _rows = rows;
+    }
+
+    void hide() noexcept { _graphic = nullptr; }
+
+    [[nodiscard]] Graphic *graphic() const noexcept { return _graphic; }
+
+    [[nodiscard]] kf::u8 rows() const noexcept { return _rows; }
+
+private:
+    Graphic *_graphic{nullptr};
+    kf::u8 _rows{0};
+};
+
+}// namespace djc::ui
@@ -0,0 +1,227 @@
+// Copyright (c) 2026 KiraFlux
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#pragma once
+
+#include <kf/aliases.hpp>
+#include <kf/gfx/Palette.hpp>
+#include <kf/memory/Array.hpp>
+#include <kf/mixin/NonCopyable.hpp>
+
+#include "djc/diagnostics/Cycles.hpp"
+#include "djc/display/Painter.hpp"
+#include "djc/math/Trig.hpp"
+#include "djc/ui/Graphic.hpp"
+
+namespace djc::ui::graphics {
+
+/// @brief Artificial horizon with a pitch ladder
+/// @details Integer math only: angles are binary, trigonometry goes through lookup tables.
+/// Sky and ground are column spans split at the horizon; an attitude change repaints only the part of each
+/// column the horizon crossed, and the ladder rungs are erased and drawn pixel by pixel
+struct AttitudeIndicator final : Graphic, kf::mixin::NonCopyable {
+    using Color = display::Painter::Color;
+
+    static constexpr kf::usize max_width{160};
+    static constexpr kf::i32 visible_pitch_degrees{40};// area height
+
+    /// @brief Set attitude from a unit quaternion
+    void quaternion(float w, float x, float y, float z) noexcept {
+        const auto qw = static_cast<math::Q14>(w * math::q14_one);
+        const auto qx = static_cast<math::Q14>(x * math::q14_one);
+        const auto qy = static_cast<math::Q14>(y * math::q14_one);
+        const auto qz = static_cast<math::Q14>(z * math::q14_one);
+
+        // Products are Q28, shifted by 13 to get twice the value in Q14
+        const auto sin_roll = (qw * qx + qy * qz) >> 13;
+        const auto cos_roll = math::q14_one - ((qx * qx + qy * qy) >> 13);
+        const auto sin_pitch = (qw * qy - qz * qx) >> 13;
+
+        _roll = math::atan2(sin_roll, cos_roll);
+        _pitch = math::asin(sin_pitch);
+    }
+
+    [[nodiscard]] math::Angle roll() const noexcept { return _roll; }
+
+    [[nodiscard]] math::Angle pitch() const noexcept { return _pitch; }
+
+    /// @brief Duration of the last draw that changed pixels
+    [[nodiscard]] kf::u32 lastDrawUs() const noexcept { return _last_draw_us; }
+
+    void draw(display::Painter &painter, bool full) noexcept override {
+        const int width = static_cast<kf::usize>(painter.width()) < max_width ? painter.width() : static_cast<int>(max_width);
+        const int height = painter.height();
+        if (width < 2 or height < 2) { return; }
+
+        if (not full and _roll == _drawn_roll and _pitch == _drawn_pitch) { return; }
+
+        const auto start = diagnostics::cycles();
+
+        const auto s = math::sin(_roll);
+        const auto c = math::cos(_roll);
+        const bool sky_above = c >= 0;
+        if (sky_above != _sky_above) { full = true; }
+
+        const int cx = width / 2;
+        const int cy = height / 2;
+        const auto offset = pitchPixels(_pitch, height);
+
+        if (not full) {
+            // Restore what is under the previous rungs before the horizon moves
+            for (kf::u8 i = 0; i < _rungs_drawn; i += 1) {
+                const auto &rung = _rungs[i];
+                line(rung.x0, rung.y0, rung.x1, rung.y1, [&](int x, int y) {
+                    if (x < 0 or x >= width or y < 0 or y >= height) { return; }
+                    painter.fill(x, y, x, y, colorAt(x, y));
+                });
+            }
+        }
+
+        const auto top_color = sky_above ? sky : ground;
+        const auto bottom_color = sky_above ? ground : sky;
+
+        for (int x = 0; x < width; x += 1) {
+            const auto boundary = horizonRow(x - cx, s, c, offset, cy, height);
+            const auto previous = _boundary[x];
+
+            if (full) {
+                painter.fill(x, 0, x, boundary - 1, top_color);
+                painter.fill(x, boundary, x, height - 1, bottom_color);
+            } else if (boundary > previous) {
+                painter.fill(x, previous, x, boundary - 1, top_color);
+            } else if (boundary < previous) {
+                painter.fill(x, boundary, x, previous - 1, bottom_color);
+            }
+
+            _boundary[x] = static_cast<kf::i16>(boundary);
+        }
+        _sky_above = sky_above;
+
+        drawLadder(painter, s, c, offset, width, height);
+
+        // Aircraft symbol
+        painter.fill(cx - width / 6, cy, cx - 4, cy, marker);
+        painter.fill(cx + 4, cy, cx + width / 6, cy, marker);
+        painter.fill(cx - 1, cy - 1, cx + 1, cy + 1, marker);
+
+        _drawn_roll = _roll;
+        _drawn_pitch = _pitch;
+        _last_draw_us = (diagnostics::cycles() - start) / diagnostics::cyclesPerMicrosecond();
+    }
+
+private:
+    using P = kf::gfx::Palette<Color>;
+
+    static constexpr Color sky{P::blue}, ground{P::yellow}, rung_color{P::bright_white}, marker{P::bright_yellow};
+
+    static constexpr kf::u8 rungs_total{4};
+    static constexpr kf::memory::Array<kf::i8, rungs_total> rung_degrees{{-20, -10, 10, 20}};
+
+    struct Segment {
+        kf::i16 x0, y0, x1, y1;
+    };
+
+    math::Angle _roll{0}, _pitch{0};
+    math::Angle _drawn_roll{0}, _drawn_pitch{0};
+    kf::u32 _last_draw_us{0};
+
+    // Framebuffer state: first row of the bottom color per column, previous rungs
+    kf::memory::Array<kf::i16, max_width> _boundary{};
+    bool _sky_above{true};
+    kf::memory::Array<Segment, rungs_total> _rungs{};
+    kf::u8 _rungs_drawn{0};
+
+    [[nodiscard]] static kf::i32 pitchPixels(math::Angle pitch, int height) noexcept {
+        return static_cast<kf::i32>(pitch) * 360 * height / (65536 * visible_pitch_degrees);
+    }
+
+    [[nodiscard]] static kf::i64 floorDiv(kf::i64 a, kf::i64 b) noexcept {
+        const auto q = a / b;
+        return (a % b != 0 and ((a < 0) != (b < 0))) ? q - 1 : q;
+    }
+
+    /// @brief First row of the bottom color in a column: sky is where dx * sin + dy * cos < offset
+    [[nodiscard]] static int horizonRow(int dx, math::Q14 s, math::Q14 c, kf::i32 offset, int cy, int height) noexcept {
+        const auto limit = static_cast<kf::i64>(offset) * math::q14_one - static_cast<kf::i64>(dx) * s;
+
+        kf::i64 dy;
+        if (c > 0) {
+            dy = -floorDiv(-limit, c);// ceil
+        } else if (c < 0) {
+            dy = floorDiv(limit, c) + 1;
+        } else {
+            return limit > 0 ? height : 0;
+        }
+
+        const auto row = cy + dy;
+        if (row < 0) { return 0; }
+        if (row > height) { return height; }
+        return static_cast<int>(row);
+    }
+
+    [[nodiscard]] Color colorAt(int x, int y) const noexcept {
+        const bool top = y < _boundary[x];
+        return top == _sky_above ? sky : ground;
+    }
+
+    void drawLadder(display::Painter &painter, math::Q14 s, math::Q14 c, kf::i32 offset, int width, int height) noexcept {
+        const int cx = width / 2;
+        const int cy = height / 2;
+        _rungs_drawn = 0;
+
+        for (const auto degrees: rung_degrees) {
+            // Rung center lies on the horizon normal, the rung runs along the horizon
+            const auto distance = offset - static_cast<kf::i32>(degrees) * height / visible_pitch_degrees;
+            const auto half = (degrees == 10 or degrees == -10) ? width / 6 : width / 10;
+
+            const auto mx = cx + distance * s / math::q14_one;
+            const auto my = cy + distance * c / math::q14_one;
+            const auto hx = half * c / math::q14_one;
+            const auto hy = -half * s / math::q14_one;
+
+            const Segment rung{
+                .x0 = static_cast<kf::i16>(mx - hx),
+                .y0 = static_cast<kf::i16>(my - hy),
+                .x1 = static_cast<kf::i16>(mx + hx),
+                .y1 = static_cast<kf::i16>(my + hy),
+            };
+
+            // Far outside the area: skip and forget
+            if (my < -height or my > 2 * height) { continue; }
+
+            line(rung.x0, rung.y0, rung.x1, rung.y1, [&](int x, int y) {
+                if (x < 0 or x >= width or y < 0 or y >= height) { return; }
+                painter.fill(x, y, x, y, rung_color);
+            });
+
+            _rungs[_rungs_drawn] = rung;
+            _rungs_drawn += 1;
+        }
+    }
+
+    /// @brief Bresenham line
+    template<typename F> static void line(int x0, int y0, int x1, int y1, F &&plot) noexcept {
+        const int dx = x1 > x0 ? x1 - x0 : x0 - x1;
+        const int dy = -(y1 > y0 ? y1 - y0 : y0 - y1);
+        const int step_x = x0 < x1 ? 1 : -1;
+        const int step_y = y0 < y1 ? 1 : -1;
+        int error = dx + dy;
+
+        while (true) {
+            plot(x0, y0);
+            if (x0 == x1 and y0 == y1) { break; }
+
+            const int doubled = 2 * error;
+            if (doubled >= dy) {
+                error += dy;
+                x0 += step_x;
+            }
+            if (doubled <= dx) {
+                error += dx;
+                y0 += step_y;
+            }
+        }
+    }
+};
+
+}// namespace djc::ui::graphics
@@ -0,0 +1,191 @@
+// Copyright (c) 2026 KiraFlux
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#pragma once
+
+#include <kf/aliases.hpp>
+#include <kf/gfx/Palette.hpp>
+#include <kf/memory/Array.hpp>
+#include <kf/mixin/NonCopyable.hpp>
+
+#include "djc/display/Painter.hpp"
+#include "djc/ui/Graphic.hpp"
+
+namespace djc::ui::graphics {
+
+/// @brief Sweeping plot of N series over the last C samples
+/// @details Samples go to a ring buffer. Each draw adds only the columns of new samples at a cursor that wraps
+/// around the area (oscilloscope sweep), so a frame changes a few pixel columns. The vertical range follows
+/// the visible samples: it grows at once and shrinks when they use under a quarter of it, both with a full redraw.
+/// Their extremes are kept in monotonic queues updated on push, so a draw costs O(new samples)
+template<kf::u8 N, kf::usize C> struct Plot final : Graphic, kf::mixin::NonCopyable {
+    using Color = display::Painter::Color;
+    using Sample = kf::memory::Array<kf::i16, N>;
+    using Colors = kf::memory::Array<Color, N>;
+
+    explicit Plot(const Colors &colors) noexcept :
+        _colors{colors} {}
+
+    void push(const Sample &sample) noexcept {
+        const auto index = _written;
+        _samples[index % C] = sample;
+
+        // Ring keeps C samples: drop extremes leaving it, then the ones the new sample dominates
+        if (index >= C) { expire(index + 1 - C); }
+        _lows.push(index, [this](kf::u32 back, kf::u32 added) { return low(back) >= low(added); });
+        _highs.push(index, [this](kf::u32 back, kf::u32 added) { return high(back) <= high(added); });
+
+        _written += 1;
+    }
+
+    void clear() noexcept {
+        _written = 0;
+        _drawn = 0;
+        _scaled = false;
+        _lows.clear();
+        _highs.clear();
+    }
+
+    /// @brief Current vertical range
+    [[nodiscard]] kf::i32 minimum() const noexcept { return _minimum; }
+
+    [[nodiscard]] kf::i32 maximum() const noexcept { return _maximum; }
+
+    void draw(display::Painter &painter, bool full) noexcept override {
+        const auto width = static_cast<kf::u32>(static_cast<kf::usize>(painter.width()) < C ? painter.width() : C);
+        const auto height = static_cast<int>(painter.height());
+        if (width < 2 or height < 2) { return; }
+
+        if (rescale(width)) { full = true; }
+        if (_written - _drawn >= width) { full = true; }
+
+        auto first = _drawn;
+        if (full) {
+            painter.fill(0, 0, static_cast<int>(width) - 1, height - 1, P::black);
+            first = _written > width ? _written - width : 0;
+        }
+
+        for (auto index = first; index < _written; index += 1) {
+            column(painter, index, width, height);
+        }
+        _drawn = _written;
+
+        // Gap ahead of the sweep cursor
+        if (_written > 0) { clearColumn(painter, static_cast<int>(_written % width), height); }
+    }
+
+private:
+    using P = kf::gfx::Palette<Color>;
+
+    static constexpr kf::i32 min_span{8};// a flat trace is fitted as this span, or it would always look loose
+
+    /// @brief Sample indices with monotonic values, oldest first (sliding window extreme)
+    struct ExtremeQueue {
+        kf::memory::Array<kf::u32, C> indices{};
+        kf::u32 head{0}, tail{0};// entries [head, tail), positions wrap modulo C
+
+        void clear() noexcept { head = tail = 0; }
+
+        [[nodiscard]] bool empty() const noexcept { return head == tail; }
+
+        [[nodiscard]] kf::u32 front() const noexcept { return indices[head % C]; }
+
+        /// @param dominated (back, added) back can never be the extreme again
+        template<typename F> void push(kf::u32 index, F &&dominated) noexcept {
+            while (not empty() and dominated(indices[(tail - 1) % C], index)) { tail -= 1; }
+            indices[tail % C] = index;
+            tail += 1;
+        }
+
+        /// @brief Drop indices before first
+        void expire(kf::u32 first) noexcept {
+            while (not empty() and front() < first) { head += 1; }
+        }
+    };
+
+    Colors _colors;
+    kf::memory::Array<Sample, C> _samples{};
+    kf::u32 _written{0};// samples pushed
+    kf::u32 _drawn{0};  // samples drawn
+    kf::i32 _minimum{-1}, _maximum{1};
+    bool _scaled{false};
+    ExtremeQueue _lows{}, _highs{};
+
+    [[nodiscard]] kf::i32 low(kf::u32 index) const noexcept {
+        const auto &sample = _samples[index % C];
+        kf::i32 value = sample[0];
+        for (kf::u8 s = 1; s < N; s += 1) {
+            if (sample[s] < value) { value = sample[s]; }
+        }
+        return value;
+    }
+
+    [[nodiscard]] kf::i32 high(kf::u32 index) const noexcept {
+        const auto &sample = _samples[index % C];
+        kf::i32 value = sample[0];
+        for (kf::u8 s = 1; s < N; s += 1) {
+            if (sample[s] > value) { value = sample[s]; }
+        }
+        return value;
+    }
+
+    void expire(kf::u32 first) noexcept {
+        _lows.expire(first);
+        _highs.expire(first);
+    }
+
+    /// @brief Fit the range to the visible samples
+    /// @return Range changed, plot must be redrawn
+    /// @note Samples older than the area width are expired here; a wider area later fits them back as they are pushed
+    bool rescale(kf::u32 width) noexcept {
+        if (_written == 0) { return false; }
+        if (_written > width) { expire(_written - width); }
+
+        const auto low = this->low(_lows.front());
+        const auto high = this->high(_highs.front());
+
+        const auto span = high - low > min_span ? high - low : min_span;
+        const auto padding = (span - (high - low)) / 2;
+
+        const bool outside = low < _minimum or high > _maximum;
+        const bool loose = span * 4 < _maximum - _minimum;
+        if (_scaled and not outside and not loose) { return false; }
+
+        const auto margin = span / 8 + 1;
+        _minimum = low - padding - margin;
+        _maximum = high + padding + margin;
+        _scaled = true;
+        return true;
+    }
+
+    [[nodiscard]] int rowOf(kf::i32 value, int height) const noexcept {
+        return static_cast<int>((_maximum - value) * (height - 1) / (_maximum - _minimum));
+    }
+
+    void clearColumn(display::Painter &painter, int x, int height) noexcept {
+        painter.fill(x, 0, x, height - 1, P::black);
+
+        if (_minimum < 0 and _maximum > 0) {
+            const auto zero = rowOf(0, height);
+            painter.fill(x, zero, x, zero, P::bright_black);
+        }
+    }
+
+    /// @brief Draw sample at its sweep column, joined to the previous one
+    void column(display::Painter &painter, kf::u32 index, kf::u32 width, int height) noexcept {
+        const auto x = static_cast<int>(index % width);
+        clearColumn(painter, x, height);
+
+        const auto &sample = _samples[index % C];
+        const bool joined = index > 0 and _written - index < C;
+        const auto &previous = joined ? _samples[(index - 1) % C] : sample;
+
+        for (kf::u8 s = 0; s < N; s += 1) {
+            const auto y0 = rowOf(previous[s], height);
+            const auto y1 = rowOf(sample[s], height);
+            painter.fill(x, y0 < y1 ? y0 : y1, x, y0 < y1 ? y1 : y0, _colors[s]);
+        }
+    }
+};
+
+}// namespace djc::ui::graphics
@@ -6,6 +6,7 @@
 #include <kf/memory/Array.hpp>
 
 #include "djc/ConfigManager.hpp"
+#include "djc/Control.hpp"
 #include "djc/ui/UI.hpp"
 #include "djc/ui/widgets/TextInput.hpp"
 
@@ -13,12 +14,15 @@ namespace djc::ui::pages {
 
 struct ConfigPage : UI::Page {
 
-    explicit ConfigPage(UI::Page &root) noexcept :
+    explicit ConfigPage(UI::Page &root, Control &control) noexcept :
         Page{"Config"},
+        _control{control},
         _layout{{
             &root.link(),
             &_device_name_input,
             &_init_mode_selector_label,
+            &_save_profile,
+            &_forget_profile,
             &_save_storage,
             &_load_storage,
             &_reset_storage,
@@ -31,6 +35,18 @@ struct ConfigPage : UI::Page {
             storage.save();
         });
 
+        _save_profile.callback([this]() {
+            if (_control.rememberProfile()) {
+                storage.modified(true);
+            }
+        });
+
+        _forget_profile.callback([this]() {
+            if (_control.forgetProfile()) {
+                storage.modified(true);
+            }
+        });
+
         _load_storage.callback([]() {
             storage.load();
         });
@@ -41,6 +57,7 @@ struct ConfigPage : UI::Page {
 
         _init_mode_selector.callback([](Control::Mode init_mode) {
             storage.config().control.init_mode = init_mode;
+            storage.modified(true);
         });
     }
 
@@ -49,8 +66,12 @@ private:
 
     inline static auto &storage{djc::ConfigManager::instance()};
 
+    Control &_control;
+
     // widgets
     widgets::TextInput _device_name_input{};
+    UI::Button _save_profile{"Save Peer Profile"};
+    UI::Button _forget_profile{"Forget Peer Profile"};
     UI::Button _save_storage{"Save"};
     UI::Button _load_storage{"Load"};
     UI::Button _reset_storage{"Reset"};
@@ -70,7 +91,7 @@ private:
     UI::Labeled _init_mode_selector_label{"Init Control", _init_mode_selector};
 
     // layout
-    kf::memory::Array<UI::Widget *, 6> _layout;
+    kf::memory::Array<UI::Widget *, 8> _layout;
 };
 
 }// namespace djc::ui::pages
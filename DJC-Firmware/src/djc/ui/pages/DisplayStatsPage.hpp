@@ -0,0 +1,128 @@
+// Copyright (c) 2026 KiraFlux
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#pragma once
+
+#include <kf/math/Timer.hpp>
+#include <kf/math/units.hpp>
+#include <kf/memory/Array.hpp>
+#include <kf/memory/ArrayString.hpp>
+#include <kf/memory/StringView.hpp>
+
+#include "djc/DisplayManager.hpp"
+#include "djc/ui/FramePacer.hpp"
+#include "djc/ui/UI.hpp"
+
+namespace djc::ui::pages {
+
+/// @brief Display pipeline statistics (render / transfer times as p50/p99)
+struct DisplayStatsPage : UI::Page {
+    static constexpr kf::math::Milliseconds redraw_period{1000};
+
+    explicit DisplayStatsPage(UI::Page &root, DisplayManager &display_manager) noexcept :
+        Page{"Display"}, _display_manager{display_manager},
+        _layout{{
+            &root.link(),
+            &_frames_display,
+            &_paced_display,
+            &_coalesced_display,
+            &_last_frame_display,
+            &_average_display,
+            &_full_frame_display,
+            &_render_time_display,
+            &_flush_time_display,
+            &_deferred_display,
+            &_glyph_cache_display,
+            &_benchmark_button,
+            &_benchmark_display,
+        }} {
+        widgets({_layout.data(), _layout.size()});
+
+        _benchmark_button.callback([this]() {
+            const auto result = _display_manager.benchmarkText();
+
+            (void) _benchmark_buffer.format(
+                "Text %lu -> %lu us",
+                static_cast<unsigned long>(result.canvas_us),
+                static_cast<unsigned long>(result.cached_us));
+            _benchmark_display.value(_benchmark_buffer.view());
+        });
+    }
+
+    void onUpdate(kf::math::Milliseconds now) noexcept override {
+        if (not _redraw_timer.expired(now)) { return; }
+        _redraw_timer.start(now);
+
+        const auto &stats = _display_manager.flushStats();
+
+        (void) _frames_buffer.format("Frames %lu", static_cast<unsigned long>(stats.frames));
+        _frames_display.value(_frames_buffer.view());
+
+        const auto &pacing = FramePacer::instance().stats();
+        (void) _paced_buffer.format("Drawn %lu, skip %lu", static_cast<unsigned long>(pacing.rendered), static_cast<unsigned long>(pacing.skipped));
+        _paced_display.value(_paced_buffer.view());
+
+        (void) _coalesced_buffer.format("Coalesced %lu", static_cast<unsigned long>(pacing.coalesced));
+        _coalesced_display.value(_coalesced_buffer.view());
+
+        (void) _last_frame_buffer.format("Last %lu B, %u win", static_cast<unsigned long>(stats.last_frame_bytes), static_cast<unsigned>(stats.last_windows));
+        _last_frame_display.value(_last_frame_buffer.view());
+
+        (void) _average_buffer.format("Avg  %lu B", static_cast<unsigned long>(stats.averageBytes()));
+        _average_display.value(_average_buffer.view());
+
+        (void) _full_frame_buffer.format("Full %lu B", static_cast<unsigned long>(stats.full_frame_bytes));
+        _full_frame_display.value(_full_frame_buffer.view());
+
+        (void) _render_time_buffer.format("Rndr %lu/%lu us", static_cast<unsigned long>(stats.render_time.percentile(50)), static_cast<unsigned long>(stats.render_time.percentile(99)));
+        _render_time_display.value(_render_time_buffer.view());
+
+        (void) _flush_time_buffer.format("Xfer %lu/%lu us", static_cast<unsigned long>(stats.flush_time.percentile(50)), static_cast<unsigned long>(stats.flush_time.percentile(99)));
+        _flush_time_display.value(_flush_time_buffer.view());
+
+        (void) _deferred_buffer.format("Deferred %lu", static_cast<unsigned long>(stats.deferred));
+        _deferred_display.value(_deferred_buffer.view());
+
+        const auto &glyphs = _display_manager.glyphCacheStats();
+        (void) _glyph_cache_buffer.format("Glyph hit %lu miss %lu", static_cast<unsigned long>(glyphs.hits), static_cast<unsigned long>(glyphs.misses));
+        _glyph_cache_display.value(_glyph_cache_buffer.view());
+
+        FramePacer::instance().request();
+    }
+
+private:
+    DisplayManager &_display_manager;
+    kf::math::Timer _redraw_timer{redraw_period};
+
+    // widgets
+
+    kf::memory::ArrayString<32> _frames_buffer{"..."};
+    kf::memory::ArrayString<32> _paced_buffer{"..."};
+    kf::memory::ArrayString<32> _coalesced_buffer{"..."};
+    kf::memory::ArrayString<32> _last_frame_buffer{"..."};
+    kf::memory::ArrayString<32> _average_buffer{"..."};
+    kf::memory::ArrayString<32> _full_frame_buffer{"..."};
+    kf::memory::ArrayString<32> _render_time_buffer{"..."};
+    kf::memory::ArrayString<32> _flush_time_buffer{"..."};
+    kf::memory::ArrayString<32> _deferred_buffer{"..."};
+    kf::memory::ArrayString<32> _glyph_cache_buffer{"..."};
+    kf::memory::ArrayString<32> _benchmark_buffer{"..."};
+
+    UI::Display<kf::memory::StringView> _frames_display{_frames_buffer.view()};
+    UI::Display<kf::memory::StringView> _paced_display{_paced_buffer.view()};
+    UI::Display<kf::memory::StringView> _coalesced_display{_coalesced_buffer.view()};
+    UI::Display<kf::memory::StringView> _last_frame_display{_last_frame_buffer.view()};
+    UI::Display<kf::memory::StringView> _average_display{_average_buffer.view()};
+    UI::Display<kf::memory::StringView> _full_frame_display{_full_frame_buffer.view()};
+    UI::Display<kf::memory::StringView> _render_time_display{_render_time_buffer.view()};
+    UI::Display<kf::memory::StringView> _flush_time_display{_flush_time_buffer.view()};
+    UI::Display<kf::memory::StringView> _deferred_display{_deferred_buffer.view()};
+    UI::Display<kf::memory::StringView> _glyph_cache_display{_glyph_cache_buffer.view()};
+
+    UI::Button _benchmark_button{"Text bench"};
+    UI::Display<kf::memory::StringView> _benchmark_display{_benchmark_buffer.view()};
+
+    kf::memory::Array<UI::Widget *, 13> _layout;
+};
+
+}// namespace djc::ui::pages
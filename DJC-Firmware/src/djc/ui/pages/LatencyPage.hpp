@@ -0,0 +1,90 @@
+// Copyright (c) 2026 KiraFlux
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#pragma once
+
+#include <kf/math/Timer.hpp>
+#include <kf/math/units.hpp>
+#include <kf/memory/Array.hpp>
+#include <kf/memory/ArrayString.hpp>
+#include <kf/memory/StringView.hpp>
+
+#include "djc/diagnostics/LatencyTracer.hpp"
+#include "djc/ui/FramePacer.hpp"
+#include "djc/ui/UI.hpp"
+
+namespace djc::ui::pages {
+
+/// @brief Input-to-air latency histograms summary (requires DJC_LATENCY_TRACE)
+struct LatencyPage : UI::Page {
+    static constexpr kf::math::Milliseconds redraw_period{1000};
+    static constexpr auto rows_total{diagnostics::LatencyTracer::stages_total - 1};// AdcSample is the origin
+
+    explicit LatencyPage(UI::Page &root) noexcept :
+        Page{"Latency"},
+        _layout{{
+            &root.link(),
+            &_dump_button,
+            &_reset_button,
+            &_header,
+        }} {
+        for (auto i = 0; i < rows_total; i += 1) {
+            _layout[i + rows_start_index] = &_rows[i];
+        }
+
+        widgets({_layout.data(), _layout.size()});
+
+        _dump_button.callback([]() {
+            tracer.dump();
+        });
+
+        _reset_button.callback([]() {
+            tracer.reset();
+        });
+    }
+
+    void onUpdate(kf::math::Milliseconds now) noexcept override {
+        if (not _redraw_timer.expired(now)) { return; }
+        _redraw_timer.start(now);
+
+        for (auto i = 0; i < rows_total; i += 1) {
+            const auto stage = static_cast<diagnostics::LatencyTracer::Stage>(i + 1);
+            const auto &h = tracer.histogram(stage);
+
+            (void) _row_buffers[i].format(
+                "%-4s %5lu %5lu %5lu",
+                diagnostics::LatencyTracer::stringFromStage(stage).data(),
+                static_cast<unsigned long>(h.percentile(50)),
+                static_cast<unsigned long>(h.percentile(99)),
+                static_cast<unsigned long>(h.max));
+            _rows[i].value(_row_buffers[i].view());
+        }
+
+        FramePacer::instance().request();
+    }
+
+private:
+    static constexpr auto rows_start_index{4};
+
+    inline static auto &tracer{diagnostics::LatencyTracer::instance()};
+
+    kf::math::Timer _redraw_timer{redraw_period};
+
+    // widgets
+    UI::Button _dump_button{"Dump to Serial"};
+    UI::Button _reset_button{"Reset"};
+    UI::Display<kf::memory::StringView> _header{kf::memory::StringView{"us     p50   p99   max"}};
+
+    kf::memory::Array<kf::memory::ArrayString<32>, rows_total> _row_buffers{};
+    kf::memory::Array<UI::Display<kf::memory::StringView>, rows_total> _rows{{
+        {_row_buffers[0].view()},
+        {_row_buffers[1].view()},
+        {_row_buffers[2].view()},
+        {_row_buffers[3].view()},
+    }};
+
+    // layout
+    kf::memory::Array<UI::Widget *, (rows_start_index + rows_total)> _layout;
+};
+
+}// namespace djc::ui::pages
@@ -3,54 +3,71 @@
 
 #pragma once
 
-#include <MAVLink.h>
-
-#include <kf/Logger.hpp>
+#include <kf/gfx/Palette.hpp>
 #include <kf/math/units.hpp>
 #include <kf/memory/Array.hpp>
 #include <kf/memory/ArrayString.hpp>
 #include <kf/memory/StringView.hpp>
 
 #include "djc/Control.hpp"
+#include "djc/math/Trig.hpp"
+#include "djc/ui/FramePacer.hpp"
+#include "djc/ui/Graphic.hpp"
 #include "djc/ui/UI.hpp"
+#include "djc/ui/graphics/AttitudeIndicator.hpp"
+#include "djc/ui/graphics/Plot.hpp"
 
 namespace djc::ui::pages {
 
 /// @brief MAVLink telemetry page
 struct MavLinkPage : UI::Page {
+
+    static constexpr kf::u8 graphic_rows{8};
+    static constexpr kf::usize plot_samples{160};// screen width
+
     explicit MavLinkPage(UI::Page &root, Control &control) noexcept :
         Page{"MAV Link"}, _control{control},
         _layout{{
             &root.link(),
+            &_view_button,
             &_imu_display,
             &_attitude_display,
         }} {
+        _view_button.callback([this]() {
+            _horizon_view = not _horizon_view;
+            _view_button.label(_horizon_view ? "View: Horizon" : "View: Accel");
+            showGraphic();
+            FramePacer::instance().request();
+        });
+
         widgets({_layout.data(), _layout.size()});
     }
 
     void onEntry() noexcept override {
-        _control.mode(Control::Mode::MavLink);
-        _control.onMavlinkMessage([this](mavlink_message_t *message) {
-            _need_update |= onMavLinkMessage(message);
-        });
+        _control.requestMode(Control::Mode::MavLink);
+        _control.sampleImu(true);
+        showGraphic();
     }
 
     void onExit() noexcept override {
-        _control.onMavlinkMessage(Control::MavLinkMessageCallback{nullptr});
+        _control.sampleImu(false);
+        GraphicView::instance().hide();
     }
 
     void onUpdate(kf::math::Milliseconds now) noexcept override {
-        if (_need_update) {
-            _need_update = false;
-            UI::instance().addEvent(UI::Event::update());
+        const bool shown = onTelemetry(_control.telemetry());
+        const bool plotted = plotImuSamples();
+
+        if (shown or plotted) {
+            FramePacer::instance().request();
         }
     }
 
 private:
-    static constexpr auto logger{kf::Logger::create("MavLinkPage")};
+    using P = kf::gfx::Palette<DisplayDriver::PixelImpl>;
 
     Control &_control;
-    bool _need_update{false}; 
+    kf::u32 _attitude_updates{0}, _imu_updates{0};// of the last shown telemetry
 
     // widgets
 
@@ -60,56 +77,74 @@ private:
     UI::Display<kf::memory::StringView> _attitude_display{_attitude_buffer.view()};
     UI::Display<kf::memory::StringView> _imu_display{_imu_display_buffer.view()};
 
-    kf::memory::Array<UI::Widget *, 3> _layout;
-
-    [[nodiscard]] bool onMavLinkMessage(mavlink_message_t *message) noexcept {
-        switch (message->msgid) {
-            case MAVLINK_MSG_ID_ATTITUDE_QUATERNION: {
-                mavlink_attitude_quaternion_t attitude_quaternion;
-                mavlink_msg_attitude_quaternion_decode(message, &attitude_quaternion);
-
-                (void) _attitude_buffer.format(
-                    "AtQ %+.2f %+.2f %+.2f %+.2f",
-                    float(attitude_quaternion.q1),
-                    float(attitude_quaternion.q2),
-                    float(attitude_quaternion.q3),
-                    float(attitude_quaternion.q4));
-                _attitude_display.value(_attitude_buffer.view());
-
-                return true;
-            }
-
-            case MAVLINK_MSG_ID_SERIAL_CONTROL: {
-                mavlink_serial_control_t serial_control;
-                mavlink_msg_serial_control_decode(message, &serial_control);
-
-                constexpr auto len{sizeof(serial_control.data)};
-                serial_control.data[len - 1] = '\0';
-            
-                logger.info({reinterpret_cast<const char *>(serial_control.data), static_cast<kf::usize>(serial_control.count)});
-
-                return false;
-            }
-
-            case MAVLINK_MSG_ID_SCALED_IMU: {
-                mavlink_scaled_imu_t imu;
-                mavlink_msg_scaled_imu_decode(message, &imu);
-
-                (void) _imu_display_buffer.format(
-                    "Acc %+.3f %+.3f %+.3f",
-                    float(imu.xacc * 0.001f),
-                    float(imu.yacc * 0.001f),
-                    float(imu.zacc * 0.001f));
-                _imu_display.value(_imu_display_buffer.view());
-
-                return true;
-            }
-
-            default:
-                // Unhandled message type
-                return false;
+    UI::Button _view_button{"View: Accel"};
+    bool _horizon_view{false};
+
+    // Acceleration X, Y, Z in mG
+    graphics::Plot<3, plot_samples> _acc_plot{{P::bright_red, P::bright_green, P::bright_blue}};
+    graphics::AttitudeIndicator _horizon{};
+
+    kf::memory::Array<UI::Widget *, 4> _layout;
+
+    void showGraphic() noexcept {
+        if (_horizon_view) {
+            GraphicView::instance().show(_horizon, graphic_rows);
+        } else {
+            GraphicView::instance().show(_acc_plot, graphic_rows);
         }
     }
+
+    /// @return Something new is shown
+    [[nodiscard]] bool onTelemetry(const Control::Telemetry &telemetry) noexcept {
+        bool updated{false};
+
+        if (telemetry.attitude_updates != _attitude_updates) {
+            _attitude_updates = telemetry.attitude_updates;
+
+            const auto &q = telemetry.quaternion;
+            _horizon.quaternion(q[0], q[1], q[2], q[3]);
+
+            (void) _attitude_buffer.format(
+                "Roll %+4d Pitch %+3d %uus",
+                static_cast<int>(math::degrees(_horizon.roll())),
+                static_cast<int>(math::degrees(_horizon.pitch())),
+                static_cast<unsigned>(_horizon.lastDrawUs()));
+            _attitude_display.value(_attitude_buffer.view());
+
+            updated = true;
+        }
+
+        if (telemetry.imu_updates != _imu_updates) {
+            _imu_updates = telemetry.imu_updates;
+
+            const auto &acc = telemetry.acceleration;
+            (void) _imu_display_buffer.format(
+                "Acc %+.3f %+.3f %+.3f",
+                float(acc[0] * 0.001f),
+                float(acc[1] * 0.001f),
+                float(acc[2] * 0.001f));
+            _imu_display.value(_imu_display_buffer.view());
+
+            updated = true;
+        }
+
+        return updated;
+    }
+
+    /// @brief Every reading since the last poll goes to the plot, not only the newest one
+    /// @return Something was pushed
+    [[nodiscard]] bool plotImuSamples() noexcept {
+        Control::ImuSample sample;
+        bool pushed{false};
+
+        while (_control.takeImuSample(sample)) {
+            const auto &acc = sample.acceleration;
+            _acc_plot.push({acc[0], acc[1], acc[2]});
+            pushed = true;
+        }
+
+        return pushed;
+    }
 };
 
 }// namespace djc::ui::pages
\ No newline at end of file
@@ -3,7 +3,7 @@
 
 #pragma once
 
-#include <Arduino.h>// for millis
+#include <algorithm>
 
 #include <kf/Logger.hpp>
 #include <kf/math/Timer.hpp>
@@ -12,20 +12,26 @@
 #include <kf/memory/ArrayString.hpp>
 #include <kf/memory/Slice.hpp>
 
+#include "djc/Clock.hpp"
 #include "djc/Control.hpp"
+#include "djc/memory/MacMap.hpp"
+#include "djc/memory/Ring.hpp"
+#include "djc/ui/FramePacer.hpp"
 #include "djc/ui/UI.hpp"
 #include "djc/ui/widgets/PeerDisplay.hpp"
+#include "djc/ui/widgets/VirtualList.hpp"
 #include "djc/prelude.hpp"
 
 namespace djc::ui::pages {
 
 struct PeerExplorerPage : UI::Page {
 
-    static constexpr auto max_peer_display{8};
-    static constexpr auto peer_display_start_index{3};
+    static constexpr kf::u8 max_peers{32};
+    static constexpr kf::u8 visible_peers{8};
+    static constexpr auto peer_list_start_index{3};
     static constexpr kf::math::Milliseconds redraw_period{500};
 
-    explicit constexpr PeerExplorerPage(UI::Page &root, Control &control) noexcept :
+    explicit PeerExplorerPage(UI::Page &root, Control &control) noexcept :
         Page{"Peer Explorer"},
         _control{control},
         _layout{{
@@ -35,20 +41,23 @@ struct PeerExplorerPage : UI::Page {
         }}
 
     {
-        for (auto i = 0; i < _peer_displays.size(); i += 1) {
-            _peer_displays[i].control(_control);
-            _layout[i + peer_display_start_index] = &_peer_displays[i];
+        for (auto &peer: _peer_source.peers) {
+            peer.control(_control);
+        }
+
+        for (kf::u8 i = 0; i < visible_peers; i += 1) {
+            _layout[i + peer_list_start_index] = &_peer_list.row(i);
         }
 
         _connection_button.callback([this]() {
-            if (_control.activeMac().hasValue()) {
-                _control.disconnect();
+            if (_control.state().connected) {
+                _control.requestDisconnect();
             }
         });
 
         widgets({_layout.data(), _layout.size()});
 
-        _redraw_timer.start(millis());
+        _redraw_timer.start(Clock::now());
     }
 
     void onEntry() noexcept override {
@@ -59,7 +68,8 @@ struct PeerExplorerPage : UI::Page {
                     data.size(),
                     EspNow::stringFromMac(mac).data()));
 
-            getMatched(mac).update(mac, millis());
+            // Radio task: hand over to the UI loop
+            (void) _heard.push(mac);
         });
     }
 
@@ -68,26 +78,42 @@ struct PeerExplorerPage : UI::Page {
     }
 
     void onUpdate(kf::math::Milliseconds now) noexcept override {
-        for (auto &_peer_display: _peer_displays) {
-            _peer_display.checkForClear(now);
+        EspNow::Mac mac;
+        while (_heard.pop(mac)) { _peer_source.match(mac).update(mac, now); }
+
+        for (kf::usize i = 0; i < _peer_source.size(); i += 1) {
+            _peer_source.at(i).checkForClear(now);
         }
 
+        _peer_source.compact();
+        _peer_list.sync();
+
         if (_redraw_timer.expired(now)) {
             _redraw_timer.start(now);
 
-            if (_control.activeMac().hasValue()) {
+            const auto &link = _control.state();
+            if (link.connected) {
                 (void) _connection_button_label.format(
                     "\xFC""OK: %s\x80",
-                    EspNow::stringFromMac(_control.activeMac().value()).data());
+                    EspNow::stringFromMac(link.mac).data());
                 _connection_button.label(_connection_button_label.view());
             } else {
                 _connection_button.label("\xF9""Disconnected\x80");
             }
 
-            (void) _available_label_value.format(" Available: %d", countAvailablePeers());
+            const auto available = _peer_source.size();
+            if (available > visible_peers) {
+                (void) _available_label_value.format(
+                    " Available: %d (%d-%d)",
+                    static_cast<int>(available),
+                    static_cast<int>(_peer_list.offset() + 1),
+                    static_cast<int>(std::min(_peer_list.offset() + visible_peers, available)));
+            } else {
+                (void) _available_label_value.format(" Available: %d", static_cast<int>(available));
+            }
             _available_label.value(_available_label_value.view());
 
-            UI::instance().addEvent(UI::Event::update());
+            FramePacer::instance().request();
         }
     }
 
@@ -96,33 +122,85 @@ private:
 
     Control &_control;
     kf::math::Timer _redraw_timer{redraw_period};
-    kf::memory::ArrayString<16> _available_label_value{""};
+    kf::memory::ArrayString<32> _available_label_value{""};
     kf::memory::ArrayString<64> _connection_button_label{};
 
-    // widgets
-    UI::Button _connection_button{""};
-    UI::Display<kf::memory::StringView> _available_label{_available_label_value.view()};
-    kf::memory::Array<widgets::PeerDisplay, max_peer_display> _peer_displays{};
+    /// @brief Heard peers in order of appearance, presented through the peer list
+    struct PeerSource final : widgets::ListSource {
+        kf::memory::Array<widgets::PeerDisplay, max_peers> peers{};
 
-    // layout
-    kf::memory::Array<UI::Widget *, (peer_display_start_index + max_peer_display)> _layout;
+        [[nodiscard]] kf::usize size() const noexcept override { return _count; }
+
+        void render(kf::usize index, UI::RenderImpl &render) const noexcept override { at(index).doRender(render); }
+
+        bool click(kf::usize index) noexcept override { return at(index).onClick(); }
+
+        [[nodiscard]] widgets::PeerDisplay &at(kf::usize index) noexcept { return peers[_order[index]]; }
+
+        [[nodiscard]] const widgets::PeerDisplay &at(kf::usize index) const noexcept { return peers[_order[index]]; }
+
+        /// @brief Entry of given peer: existing, free or the oldest one
+        widgets::PeerDisplay &match(const EspNow::Mac &mac) noexcept {
+            compact();
+
+            if (const auto *slot = _slots.find(mac)) { return peers[*slot]; }
+
+            if (_count == max_peers) {
+                const auto oldest = _order[0];
+                remove(0);
+                return append(oldest, mac);
+            }
 
-    widgets::PeerDisplay &getMatched(const EspNow::Mac &mac) noexcept {
-        for (auto &_peer_display: _peer_displays) {
-            if (not _peer_display.mac().hasValue()) { return _peer_display; }
-            if (_peer_display.mac().value() == mac) { return _peer_display; }
+            for (kf::u8 slot = 0; slot < max_peers; slot += 1) {
+                if (not peers[slot].mac().hasValue()) { return append(slot, mac); }
+            }
+
+            return peers[0];
         }
 
-        return _peer_displays[0];
-    }
+        /// @brief Drop cleared and connected entries
+        void compact() noexcept {
+            for (kf::usize i = _count; i > 0; i -= 1) {
+                if (not at(i - 1).mac().hasValue()) { remove(i - 1); }
+            }
+        }
 
-    int countAvailablePeers() const noexcept {
-        int available = 0;
-        for (auto &_peer_display: _peer_displays) {
-            available += int(_peer_display.mac().hasValue());
+    private:
+        kf::memory::Array<kf::u8, max_peers> _order{};// peer slots, oldest first
+        kf::usize _count{0};
+        memory::MacMap<kf::u8, max_peers * 2> _slots{memory::MacMap<kf::u8, max_peers * 2>::defaults()};// listed peer -> slot
+        kf::memory::Array<EspNow::Mac, max_peers> _slot_macs{};                                           // key of each listed slot
+
+        widgets::PeerDisplay &append(kf::u8 slot, const EspNow::Mac &mac) noexcept {
+            _order[_count] = slot;
+            _count += 1;
+            inserted(_count - 1);
+            _slot_macs[slot] = mac;
+            (void) _slots.insert(mac, slot);
+            return peers[slot];
         }
-        return available;
-    }
+
+        void remove(kf::usize index) noexcept {
+            (void) _slots.erase(_slot_macs[_order[index]]);
+
+            for (auto i = index; i + 1 < _count; i += 1) {
+                _order[i] = _order[i + 1];
+            }
+            _count -= 1;
+            removed(index);
+        }
+    };
+
+    PeerSource _peer_source{};
+    memory::Ring<EspNow::Mac, 16> _heard{};// peers heard by the radio task, not yet listed
+
+    // widgets
+    UI::Button _connection_button{""};
+    UI::Display<kf::memory::StringView> _available_label{_available_label_value.view()};
+    widgets::VirtualList<visible_peers> _peer_list{_peer_source};
+
+    // layout
+    kf::memory::Array<UI::Widget *, (peer_list_start_index + visible_peers)> _layout;
 };
 
 }// namespace djc::ui::pages
\ No newline at end of file
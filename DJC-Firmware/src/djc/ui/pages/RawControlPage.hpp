@@ -29,12 +29,14 @@ struct RawControlPage : UI::Page {
 
             logger.debug(s);
 
-            _control.sendRawMessage({reinterpret_cast<const kf::u8 *>(s.data()), s.size()});
+            if (not _control.requestSendRaw({reinterpret_cast<const kf::u8 *>(s.data()), s.size()})) {
+                logger.error("Message not sent");
+            }
         });
     }
 
     void onEntry() noexcept override {
-        _control.mode(Control::Mode::Raw);
+        _control.requestMode(Control::Mode::Raw);
         _control.onRawMessage([](kf::memory::Slice<const kf::u8> buffer) {
             logger.info(
                 kf::memory::ArrayString<64>::formatted(
@@ -6,27 +6,57 @@
 #include <kf/memory/Array.hpp>
 
 #include "djc/ui/UI.hpp"
+#include "djc/ui/widgets/VirtualList.hpp"
 
 namespace djc::ui::pages {
 
 /// @brief Main menu page for ESP32-DJC
+/// @details Page links are shown through a VirtualList: any number of pages fits, left / right pages the menu
 struct RootPage : UI::Page {
-    static constexpr auto max_items{4};
+    static constexpr kf::u8 max_items{16};
+    static constexpr kf::u8 visible_items{6};
 
-    explicit constexpr RootPage() noexcept : Page{"Main"} {}
+    explicit RootPage() noexcept : Page{"Main"} {
+        for (kf::u8 i = 0; i < visible_items; i += 1) {
+            _layout[i] = &_list.row(i);
+        }
+    }
 
     void attach(UI::Page &page) noexcept {
-        if (_items >= _layout.size()) { return; }
+        if (not _source.add(page.link())) { return; }
 
-        _layout[_items] = &page.link();
+        _list.sync();
 
-        _items += 1;
-        widgets({_layout.data(), _items});
+        const auto shown = _source.size() < visible_items ? _source.size() : visible_items;
+        widgets({_layout.data(), shown});
     }
 
 private:
-    kf::memory::Array<UI::Widget *, max_items> _layout{};
-    kf::usize _items{0};
+    /// @brief Links of attached pages in attach order
+    struct LinkSource final : widgets::ListSource {
+        [[nodiscard]] kf::usize size() const noexcept override { return _count; }
+
+        void render(kf::usize index, UI::RenderImpl &render) const noexcept override { _links[index]->doRender(render); }
+
+        bool click(kf::usize index) noexcept override { return _links[index]->onClick(); }
+
+        bool add(UI::Widget &link) noexcept {
+            if (_count >= max_items) { return false; }
+
+            _links[_count] = &link;
+            _count += 1;
+            inserted(_count - 1);
+            return true;
+        }
+
+    private:
+        kf::memory::Array<UI::Widget *, max_items> _links{};
+        kf::usize _count{0};
+    };
+
+    LinkSource _source{};
+    widgets::VirtualList<visible_items> _list{_source};
+    kf::memory::Array<UI::Widget *, visible_items> _layout{};
 };
 
-}// namespace djc::ui::pages
\ No newline at end of file
+}// namespace djc::ui::pages
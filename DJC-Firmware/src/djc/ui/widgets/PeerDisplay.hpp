@@ -79,7 +79,7 @@ struct PeerDisplay final : UI::Widget {
         if (not _mac_option.hasValue()) { return false; }
 
         if (_control != nullptr) {
-            _control->connect(_mac_option.value());
+            _control->requestConnect(_mac_option.value());
             _mac_option = {};
         }
 
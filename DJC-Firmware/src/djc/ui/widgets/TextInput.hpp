@@ -45,7 +45,7 @@ struct TextInput final : UI::Widget {
         return true;
     }
 
-    bool onEventValue(UI::Event::Value event_value) noexcept {
+    bool onEventValue(UI::Event::Value event_value) noexcept override {
         if (virtual_keyboard.active()) {
             virtual_keyboard.move(static_cast<input::VirtualKeyboard::Direction>(event_value));
             return true;
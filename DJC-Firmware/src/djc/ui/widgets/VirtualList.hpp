@@ -0,0 +1,141 @@
+// Copyright (c) 2026 KiraFlux
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#pragma once
+
+#include <kf/aliases.hpp>
+#include <kf/memory/Array.hpp>
+#include <kf/memory/StringView.hpp>
+#include <kf/mixin/NonCopyable.hpp>
+
+#include "djc/ui/UI.hpp"
+
+namespace djc::ui::widgets {
+
+/// @brief Items shown by a VirtualList
+struct ListSource {
+    /// @brief Told where items were inserted or removed, so a window over them follows without searching
+    struct Observer {
+        virtual void onInserted(kf::usize index) noexcept = 0;
+        virtual void onRemoved(kf::usize index) noexcept = 0;
+    };
+
+    virtual ~ListSource() = default;
+
+    [[nodiscard]] virtual kf::usize size() const noexcept = 0;
+
+    virtual void render(kf::usize index, UI::RenderImpl &render) const noexcept = 0;
+
+    virtual bool click(kf::usize index) noexcept {
+        (void) index;
+        return false;
+    }
+
+    void observer(Observer *observer) noexcept { _observer = observer; }
+
+protected:
+    /// @brief Item now at index was inserted
+    void inserted(kf::usize index) const noexcept {
+        if (_observer != nullptr) { _observer->onInserted(index); }
+    }
+
+    /// @brief Item at index was removed, the following ones moved up
+    void removed(kf::usize index) const noexcept {
+        if (_observer != nullptr) { _observer->onRemoved(index); }
+    }
+
+private:
+    Observer *_observer{nullptr};
+};
+
+/// @brief Window of N row widgets over a ListSource of any size
+/// @details Only the visible rows are rendered. The source reports insertions and removals, so the top item keeps
+/// its row (and the page cursor its item) when others come and go; sync() costs O(1). Left / right on a row pages the list
+template<kf::u8 N> struct VirtualList final : kf::mixin::NonCopyable, ListSource::Observer {
+
+    explicit VirtualList(ListSource &source) noexcept :
+        _source{source} {
+        for (kf::u8 i = 0; i < N; i += 1) { _rows[i].bind(*this, i); }
+        _source.observer(this);
+    }
+
+    static constexpr kf::u8 rowsTotal() noexcept { return N; }
+
+    /// @brief Row widget to place in the page layout
+    [[nodiscard]] UI::Widget &row(kf::u8 index) noexcept { return _rows[index]; }
+
+    /// @brief First visible item index
+    [[nodiscard]] kf::usize offset() const noexcept { return _offset; }
+
+    /// @brief Keep the window inside the source after items were removed from its end
+    void sync() noexcept { clampOffset(_source.size()); }
+
+    // Offset follows its item; when the top item itself is removed, the next one takes its row
+    void onInserted(kf::usize index) noexcept override {
+        if (index <= _offset and _offset + 1 < _source.size()) { _offset += 1; }
+    }
+
+    void onRemoved(kf::usize index) noexcept override {
+        if (index < _offset) { _offset -= 1; }
+    }
+
+    /// @brief Move the window by given items
+    void scroll(kf::isize delta) noexcept {
+        if (delta < 0 and static_cast<kf::usize>(-delta) > _offset) {
+            _offset = 0;
+        } else {
+            _offset += delta;
+        }
+
+        clampOffset(_source.size());
+    }
+
+private:
+    struct Row final : UI::Widget {
+        void bind(VirtualList &list, kf::u8 slot) noexcept {
+            _list = &list;
+            _slot = slot;
+        }
+
+        void doRender(UI::RenderImpl &render) const noexcept override {
+            const auto index = _list->_offset + _slot;
+
+            if (index < _list->_source.size()) {
+                _list->_source.render(index, render);
+            } else {
+                render.value(kf::memory::StringView{"\xF8-\x80"});
+            }
+        }
+
+        bool onClick() noexcept override {
+            const auto index = _list->_offset + _slot;
+            if (index >= _list->_source.size()) { return false; }
+
+            return _list->_source.click(index);
+        }
+
+        bool onEventValue(UI::Event::Value event_value) noexcept override {
+            _list->scroll(event_value > 0 ? N : -static_cast<kf::isize>(N));
+            return true;
+        }
+
+    private:
+        VirtualList *_list{nullptr};
+        kf::u8 _slot{0};
+    };
+
+    ListSource &_source;
+    kf::memory::Array<Row, N> _rows{};
+    kf::usize _offset{0};
+
+    void clampOffset(kf::usize size) noexcept {
+        if (size == 0) {
+            _offset = 0;
+            return;
+        }
+
+        if (_offset >= size) { _offset = size - 1; }
+    }
+};
+
+}// namespace djc::ui::widgets
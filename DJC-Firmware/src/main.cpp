@@ -1,30 +1,128 @@
 // Copyright (c) 2026 KiraFlux
 // SPDX-License-Identifier: GPL-3.0-or-later
 
+#include <cstdlib>
+#include <new>
+
 #include <Arduino.h>
 
 #include <kf/Logger.hpp>
+#include <kf/memory/ArrayString.hpp>
+#include <kf/memory/Slice.hpp>
 #include <kf/memory/Storage.hpp>
 #include <kf/memory/StringView.hpp>
 
+#include "djc/Clock.hpp"
 #include "djc/ConfigManager.hpp"
 #include "djc/Control.hpp"
+#include "djc/ControlTask.hpp"
 #include "djc/DisplayManager.hpp"
 #include "djc/Periphery.hpp"
+#include "djc/PowerManager.hpp"
+#include "djc/Scheduler.hpp"
+#include "djc/diagnostics/AllocationTracer.hpp"
+#include "djc/diagnostics/ContainerCheck.hpp"
+#include "djc/diagnostics/FrameCapture.hpp"
+#include "djc/diagnostics/LoopMonitor.hpp"
+#include "djc/diagnostics/MigrationCheck.hpp"
+#include "djc/diagnostics/PowerCheck.hpp"
+#include "djc/diagnostics/SessionPlayer.hpp"
+#include "djc/diagnostics/SessionRecorder.hpp"
+#include "djc/diagnostics/SoakScenario.hpp"
+#include "djc/diagnostics/VehicleSimulator.hpp"
 #include "djc/input/InputHandler.hpp"
 #include "djc/input/VirtualKeyboard.hpp"
+#include "djc/memory/Ring.hpp"
+#include "djc/ui/FramePacer.hpp"
 #include "djc/ui/pages/ConfigPage.hpp"
+#include "djc/ui/pages/DisplayStatsPage.hpp"
+#include "djc/ui/pages/LatencyPage.hpp"
 #include "djc/ui/pages/MavLinkPage.hpp"
 #include "djc/ui/pages/PeerExplorerPage.hpp"
 #include "djc/ui/pages/RawControlPage.hpp"
 #include "djc/ui/pages/RootPage.hpp"
 
+#if defined(DJC_ALLOC_TRACE)
+// Every heap allocation of the firmware goes through the tracer: C++ operators are replaced, the C allocator is
+// wrapped at link time (-Wl,--wrap, see platformio.ini). Direct heap_caps_* calls of ESP-IDF are not seen
+
+extern "C" {
+void *__real_malloc(std::size_t size);
+void *__real_calloc(std::size_t count, std::size_t size);
+void *__real_realloc(void *block, std::size_t size);
+void __real_free(void *block);
+}
+
+static void *tracedAllocate(std::size_t size, const void *site) noexcept {
+    void *block = __real_malloc(size == 0 ? 1 : size);
+    if (block != nullptr) { djc::diagnostics::AllocationTracer::instance().allocated(site, size); }
+    return block;
+}
+
+static void tracedFree(void *block) noexcept {
+    if (block == nullptr) { return; }
+    djc::diagnostics::AllocationTracer::instance().freed();
+    __real_free(block);
+}
+
+extern "C" void *__wrap_malloc(std::size_t size) { return tracedAllocate(size, __builtin_return_address(0)); }
+
+extern "C" void *__wrap_calloc(std::size_t count, std::size_t size) {
+    void *block = __real_calloc(count, size);
+    if (block != nullptr) { djc::diagnostics::AllocationTracer::instance().allocated(__builtin_return_address(0), count * size); }
+    return block;
+}
+
+extern "C" void *__wrap_realloc(void *block, std::size_t size) {
+    if (size == 0) {
+        tracedFree(block);
+        return nullptr;
+    }
+
+    void *moved = __real_realloc(block, size);
+    if (moved == nullptr) { return nullptr; }
+
+    // May move the block: counted as a new allocation replacing the old one
+    djc::diagnostics::AllocationTracer::instance().allocated(__builtin_return_address(0), size);
+    if (block != nullptr) { djc::diagnostics::AllocationTracer::instance().freed(); }
+    return moved;
+}
+
+extern "C" void __wrap_free(void *block) { tracedFree(block); }
+
+void *operator new(std::size_t size) {
+    void *block = tracedAllocate(size, __builtin_return_address(0));
+    if (block == nullptr) { std::abort(); }
+    return block;
+}
+
+void *operator new[](std::size_t size) {
+    void *block = tracedAllocate(size, __builtin_return_address(0));
+    if (block == nullptr) { std::abort(); }
+    return block;
+}
+
+void *operator new(std::size_t size, const std::nothrow_t &) noexcept { return tracedAllocate(size, __builtin_return_address(0)); }
+
+void *operator new[](std::size_t size, const std::nothrow_t &) noexcept { return tracedAllocate(size, __builtin_return_address(0)); }
+
+void operator delete(void *block) noexcept { tracedFree(block); }
+
+void operator delete[](void *block) noexcept { tracedFree(block); }
+
+void operator delete(void *block, std::size_t) noexcept { tracedFree(block); }
+
+void operator delete[](void *block, std::size_t) noexcept { tracedFree(block); }
+#endif
+
 static auto &ui{djc::ui::UI::instance()};
 
 static auto &storage{djc::ConfigManager::instance()};
 
 static auto &virtual_keyboard{djc::input::VirtualKeyboard::instance()};
 
+static auto &frame_pacer{djc::ui::FramePacer::instance()};
+
 // services
 
 static djc::Periphery periphery{
@@ -33,20 +131,41 @@ static djc::Periphery periphery{
 
 static djc::InputHandler input_handler{
     storage.config().input_handler,
-    periphery.right_joystick,
-    periphery.left_button_listener,
-    periphery.right_button_listener,
 };
 
 static djc::Control control{
     storage.config().control,
 };
 
+static const auto glyph_cache_config{djc::DisplayManager::GlyphCache::Config::defaults()};
+
 static djc::DisplayManager display_manager{
+#if not defined(DJC_DISPLAY_STRIPS)
     periphery.display,
+#endif
+    periphery.display_transport,
     control,
+    glyph_cache_config,
 };
 
+#if defined(DJC_SESSION_REPLAY)
+#include "djc/diagnostics/ReplaySession.hpp"// generated by tools/session.py
+
+static djc::diagnostics::SessionPlayer session_player{
+    {djc::diagnostics::replay_session, sizeof(djc::diagnostics::replay_session)},
+    djc::diagnostics::replay_session_start,
+};
+#endif
+
+#if defined(DJC_SOAK_TEST)
+static const auto soak_config{djc::diagnostics::SoakScenario::Config::defaults()};
+
+static djc::diagnostics::SoakScenario soak_scenario{
+    soak_config,
+    control,
+};
+#endif
+
 // pages
 
 static djc::ui::pages::RootPage root_page{};
@@ -68,14 +187,34 @@ static djc::ui::pages::PeerExplorerPage peer_explorer_page{
 
 static djc::ui::pages::ConfigPage config_page{
     root_page,
+    control,
 };
 
+static djc::ui::pages::DisplayStatsPage display_stats_page{
+    root_page,
+    display_manager,
+};
+
+#if defined(DJC_LATENCY_TRACE)
+static djc::ui::pages::LatencyPage latency_page{
+    root_page,
+};
+#endif
+
 void setup() {
     static constexpr auto logger{kf::Logger::create("setup")};
 
     Serial.begin(115200);
     kf::Logger::writer = [](kf::memory::StringView str) { Serial.write(str.data(), str.size()); };
 
+#if defined(DJC_MIGRATION_CHECK)
+    (void) djc::diagnostics::MigrationCheck::run();
+#endif
+#if defined(DJC_CONTAINER_CHECK)
+    (void) djc::diagnostics::ContainerCheck::run();
+#endif
+
+    (void) storage.init();
     storage.load();
 
     if (not periphery.init()) {
@@ -92,7 +231,15 @@ void setup() {
         logger.debug("Axes already tuned");
     }
 
+    control.profiles(storage.config().peer_profiles);
     (void) control.init();// TODO: implement halt on error?
+
+    // Flash writes stall both cores: never while the link is driven
+    storage.holdCommits([]() { return control.state().enabled; });
+
+#if defined(DJC_VEHICLE_SIM)
+    control.connect(djc::diagnostics::VehicleSimulator::mac);
+#endif
     display_manager.init();
 
     {
@@ -102,19 +249,19 @@ void setup() {
             if (virtual_keyboard.active()) {
                 virtual_keyboard.quit();
             } else {
-                control.enabled(not control.enabled());
+                control.requestEnabled(not control.state().enabled);
             }
 
-            ui.addEvent(E::update());
+            frame_pacer.request();
         });
 
         input_handler.onRightButton([]() {
-            if (control.enabled()) { return; }
+            if (control.state().enabled) { return; }
 
             ui.addEvent(E::widgetClick());
         });
 
-        input_handler.onDirection([](djc::InputHandler::JoystickListener::Direction direction) {
+        input_handler.onDirection([](djc::InputHandler::DirectionListener::Direction direction) {
             static constexpr E navigation_event_from_direction[4] = {
                 E::pageCursorMove(-1),// Up
                 E::pageCursorMove(+1),// Down
@@ -129,7 +276,7 @@ void setup() {
                 E::widgetValue(3),// Right
             };
 
-            if (control.enabled()) { return; }
+            if (control.state().enabled) { return; }
 
             const auto table = virtual_keyboard.active() ? VirtualKeyboard_event_from_direction : navigation_event_from_direction;
             ui.addEvent(table[static_cast<kf::u8>(direction)]);
@@ -140,31 +287,261 @@ void setup() {
         root_page.attach(raw_control_page);
         root_page.attach(peer_explorer_page);
         root_page.attach(config_page);
+        root_page.attach(display_stats_page);
+#if defined(DJC_LATENCY_TRACE)
+        root_page.attach(latency_page);
+#endif
 
         ui.bindPage(root_page);
         ui.addEvent(E::update());
     }
 
     if (storage.modified()) { storage.save(); }
+
+#if defined(DJC_ALLOC_TRACE)
+    djc::diagnostics::AllocationTracer::instance().arm();
+#endif
 }
 
+/// @brief Input-to-air path of one input frame
+static void controlTick(const djc::input::InputFrame &frame) {
+    DJC_SESSION_RECORD_CALL(frame, frame);
+
+    if (control.enabled()) {
+        control.input(djc::Control::Input::fromFrame(frame));
+    }
+    control.poll(frame.timestamp);
+    DJC_VEHICLE_SIM_CALL(
+        poll, frame.timestamp, [](kf::memory::Slice<const kf::u8> payload) { control.receive(payload); },
+        control.imuSamplesDropped());
+}
+
+/// @brief Every service in one go, for frame-driven diagnostics loops
+[[maybe_unused]] static void tick(const djc::input::InputFrame &frame) {
+    input_handler.update(frame);
+    controlTick(frame);
+    display_manager.poll(frame.timestamp);
+    ui.poll(frame.timestamp);
+#if not defined(DJC_OFFLINE_RADIO)
+    storage.poll(frame.timestamp);// replay and soak runs must not write flash
+#endif
+}
+
+#if defined(DJC_SESSION_REPLAY)
+
 void loop() {
-    constexpr kf::math::Milliseconds loop_period{1000 / 50};// 50 Hz
-    delay(loop_period);
+    static constexpr auto logger{kf::Logger::create("replay")};
+
+    using Kind = djc::diagnostics::SessionRecord::Kind;
+    using Player = djc::diagnostics::SessionPlayer;
+
+    // Recorded frames and traffic drive the virtual clock: no waiting between ticks
+    Player::Record record;
+    if (not session_player.next(record)) {
+        static bool reported{false};
+        if (not reported) {
+            reported = true;
+            logger.info("Session finished");
+        }
+        return;
+    }
 
-    const auto now = millis();
-    input_handler.poll(now);
+    djc::Clock::set(record.time);
 
-    if (control.enabled()) {
-        using I = djc::Control::Input;
+    switch (record.kind) {
+        case Kind::Frame:
+            tick(Player::frameFromRecord(record));
+            return;
+
+        case Kind::Receive:
+            control.receive(record.payload);
+            return;
+
+        case Kind::ReceiveUnknown:
+            control.receiveFromUnknown(Player::macFromRecord(record), Player::dataFromUnknownRecord(record));
+            return;
+
+        case Kind::Time:
+        case Kind::Button:// edges are contained in frames
+        case Kind::Send:  // regenerated by Control
+            return;
+    }
+}
+
+#elif defined(DJC_SOAK_TEST)
+
+void loop() {
+    static constexpr auto logger{kf::Logger::create("soak")};
+    static constexpr kf::math::Milliseconds loop_period{1000 / 50};// 50 Hz
+
+    static djc::diagnostics::LoopMonitor monitor{loop_period};
+    static const auto start{djc::Clock::now()};
+    static auto deadline{start};
+    static auto next_report{soak_config.report_period};
+    static bool finished{false};
+
+    if (finished) { return; }
+
+    // Virtual time: no real waiting, hours of scenario pass in seconds.
+    // Paced by deadlines as on hardware, so the scripted tick time below must not accumulate into drift
+    deadline += loop_period;
+    const auto before = djc::Clock::now();
+    if (deadline > before) { djc::Clock::sleep(deadline - before); }
+
+    const auto now = djc::Clock::now();
+    const auto elapsed = now - start;
+
+    monitor.begin(now);
+    soak_scenario.poll(elapsed);
+    tick(soak_scenario.frame(now, elapsed));
+    djc::Clock::sleep(soak_scenario.jitter(loop_period));
+    monitor.end();
+
+    if (elapsed >= next_report) {
+        next_report += soak_config.report_period;
+        logger.info(kf::memory::ArrayString<32>::formatted("t = %lu s", static_cast<unsigned long>(elapsed / 1000)).view());
+        monitor.report();
+    }
+
+    if (soak_scenario.finished(elapsed)) {
+        finished = true;
+        logger.info("Soak finished");
+        monitor.report();
+    }
+}
+
+#elif defined(DJC_POWER_CHECK)
+
+static const auto power_config{djc::PowerManager::Config::defaults()};
+
+static djc::diagnostics::SimulatedSleep simulated_sleep{};
+
+static djc::PowerManager power_manager{
+    power_config,
+    control,
+    display_manager,
+    simulated_sleep,
+};
+
+void loop() {
+    static bool finished{false};
+    if (finished) { return; }
+    finished = true;
+
+    djc::diagnostics::PowerCheck check{power_manager, control, simulated_sleep, tick};
+    (void) check.run();
+}
+
+#else
+
+static djc::Scheduler scheduler{};
+
+static constexpr kf::math::Milliseconds control_period{1000 / 50};// 50 Hz input sampling
+
+/// @brief Frames sampled by the control task, drained by the main loop for navigation
+static djc::memory::Ring<djc::input::InputFrame, 8> input_frames{};
 
-        control.input({
-            .left_x = I::fromReal(periphery.left_joystick.axis_x.read()),
-            .left_y = I::fromReal(periphery.left_joystick.axis_y.read()),
-            .right_x = I::fromReal(periphery.right_joystick.axis_x.read()),
-            .right_y = I::fromReal(periphery.right_joystick.axis_y.read()),
+static djc::ControlTask control_task{
+    control_period,
+    [](kf::math::Milliseconds now) {
+        // Single hardware sample shared by both cores
+        const auto frame = periphery.sample(now);
+        (void) input_frames.push(frame);
+        controlTick(frame);
+    },
+};
+
+static const auto power_config{djc::PowerManager::Config::defaults()};
+
+static djc::EspSleepBackend sleep_backend{};
+
+static djc::PowerManager power_manager{
+    power_config,
+    control,
+    display_manager,
+    sleep_backend,
+};
+
+/// @brief Diagnostic commands typed into the serial monitor
+static void serialCommand(char command) {
+    switch (command) {
+        case 'T':
+            scheduler.report();
+            control_task.report();
+            return;
+
+        case 'P':
+            power_manager.report();
+            return;
+
+#if defined(DJC_SESSION_RECORD)
+        case 'S':
+            djc::diagnostics::SessionRecorder::instance().dump();
+            return;
+#endif
+
+#if defined(DJC_ALLOC_TRACE)
+        case 'A':
+            djc::diagnostics::AllocationTracer::instance().dump();
+            return;
+#endif
+
+#if defined(DJC_FRAME_CAPTURE)
+        case 'C':
+            djc::diagnostics::FrameCapture::instance().request();
+            frame_pacer.request();
+            return;
+#endif
+
+        default:
+            return;
+    }
+}
+
+/// @brief Start the control task and register main loop services, in the order they run when due together
+static void schedule() {
+    if (not control_task.init()) {
+        // Single core fallback: the loop samples and controls itself
+        (void) scheduler.add("control", control_period, 0, [](kf::math::Milliseconds now) {
+            const auto frame = periphery.sample(now);
+            if (power_manager.activity(frame)) { input_handler.update(frame); }
+            controlTick(frame);
         });
     }
-    control.poll(now);
-    ui.poll(now);
-}
\ No newline at end of file
+
+    scheduler.onStep([](kf::math::Milliseconds late) { storage.loopLateness(late); });
+
+    // Idle: slower loop and control task, restored on activity
+    power_manager.onStateChange([](djc::PowerManager::State state) {
+        const bool slow = state == djc::PowerManager::State::Slow or state == djc::PowerManager::State::Sleep;
+        scheduler.stretch(slow ? power_config.slow_stretch : 1);
+        control_task.period(slow ? power_config.slow_control_period : control_period);
+    });
+
+    (void) scheduler.add("input", control_period, 0, [](kf::math::Milliseconds) {
+        djc::input::InputFrame frame{};
+        while (input_frames.pop(frame)) {
+            if (power_manager.activity(frame)) { input_handler.update(frame); }
+        }
+    });
+    (void) scheduler.add("display", display_manager, 10, 1);
+    (void) scheduler.add("ui", ui, 20, 2);
+    (void) scheduler.add("storage", storage, 100, 3);
+    (void) scheduler.add("power", power_manager, 100, 3);
+    (void) scheduler.add("serial", 50, 3, [](kf::math::Milliseconds) {
+        while (Serial.available() > 0) { serialCommand(static_cast<char>(Serial.read())); }
+    });
+}
+
+void loop() {
+    static bool scheduled{false};
+    if (not scheduled) {
+        scheduled = true;
+        schedule();
+    }
+
+    // Sleeps until the earliest deadline
+    scheduler.step();
+}
+
+#endif
@@ -0,0 +1,223 @@
+"""
+ESP32-DJC frame capture tool
+
+Extracts frames captured over serial (`C` in the monitor with DJC_FRAME_CAPTURE),
+converts them to PPM images, compares them with golden images and lists frame costs.
+
+Usage:
+    python tools/frame.py ppm <monitor.log> <out.ppm>
+    python tools/frame.py compare <monitor.log> <golden.ppm> [diff.ppm]
+    python tools/frame.py golden <monitor.log>
+    python tools/frame.py check <monitor.log>
+    python tools/frame.py bench <monitor.log>
+    python tools/frame.py modes <framebuffer.log> <strips.log>
+
+`golden` and `check` take one capture per screen of GOLDEN, in that order:
+`golden` saves them as the golden set, `check` compares them with it.
+`modes` compares frame times (render + transfer) of those screens between a default
+and a DJC_DISPLAY_STRIPS build.
+"""
+
+import re
+import sys
+from dataclasses import dataclass
+from pathlib import Path
+
+_BEGIN = re.compile(r"capture (\d+) (\d+)\s*$")
+_ROW = re.compile(r"F ([0-9a-f]+)\s*$")
+_END = re.compile(r"end (\d+) (\d+)(?: (\d+))?\s*$")
+
+GOLDEN_DIR = Path(__file__).resolve().parent.parent / "golden"
+
+# Screens of the golden set, in capture order
+GOLDEN = (
+    "root",      # main menu
+    "mavlink",   # MAVLink page, disconnected
+    "peers",     # peer explorer, no peers
+    "config",    # config page
+    "keyboard",  # virtual keyboard, empty text
+)
+
+
+@dataclass
+class Frame:
+    width: int
+    height: int
+    rows: list[bytes]
+    render_us: int
+    spi_bytes: int
+    transfer_us: int  # transfer after render, 0 when interleaved with it (strip mode) or not logged
+
+    @property
+    def frame_us(self) -> int:
+        return self.render_us + self.transfer_us
+
+    def rgb(self) -> bytes:
+        """RGB888 pixels of the RGB565 (display byte order) frame"""
+        out = bytearray()
+
+        for row in self.rows:
+            for i in range(0, self.width * 2, 2):
+                value = (row[i] << 8) | row[i + 1]
+                r = (value >> 11) & 0x1F
+                g = (value >> 5) & 0x3F
+                b = value & 0x1F
+                out += bytes(((r * 255) // 31, (g * 255) // 63, (b * 255) // 31))
+
+        return bytes(out)
+
+
+def load(path: Path) -> list[Frame]:
+    """Return every complete capture in the log"""
+    frames = []
+    current = None
+
+    for line in path.read_text(encoding="utf-8", errors="ignore").splitlines():
+        if (m := _BEGIN.search(line)) is not None:
+            current = Frame(int(m.group(1)), int(m.group(2)), [], 0, 0, 0)
+        elif current is not None and (m := _ROW.search(line)) is not None:
+            row = m.group(1)
+            # Serial lines get cut or interleaved: a damaged row drops the whole capture
+            if len(row) != current.width * 4:
+                print(f"{path}: capture row {len(current.rows)} has {len(row) // 2} bytes, expected {current.width * 2}; capture skipped")
+                current = None
+                continue
+            current.rows.append(bytes.fromhex(row))
+        elif current is not None and (m := _END.search(line)) is not None:
+            current.render_us = int(m.group(1))
+            current.spi_bytes = int(m.group(2))
+            current.transfer_us = int(m.group(3) or 0)
+
+            if len(current.rows) == current.height:
+                frames.append(current)
+            current = None
+
+    if not frames:
+        raise SystemExit(f"No complete frame capture in {path}")
+
+    return frames
+
+
+def write_ppm(path: Path, width: int, height: int, rgb: bytes):
+    path.write_bytes(f"P6\n{width} {height}\n255\n".encode("ascii") + rgb)
+
+
+def read_ppm(path: Path) -> tuple[int, int, bytes]:
+    data = path.read_bytes()
+    fields = []
+    offset = 0
+
+    # magic, width, height, max value separated by whitespace, then one whitespace byte
+    while len(fields) < 4:
+        while data[offset:offset + 1].isspace():
+            offset += 1
+        start = offset
+        while not data[offset:offset + 1].isspace():
+            offset += 1
+        fields.append(data[start:offset])
+    offset += 1
+
+    if fields[0] != b"P6" or fields[3] != b"255":
+        raise SystemExit(f"{path}: not an 8-bit binary PPM")
+
+    width, height = int(fields[1]), int(fields[2])
+    return width, height, data[offset:offset + width * height * 3]
+
+
+def compare(frame: Frame, golden: Path, diff: Path | None) -> int:
+    if not golden.exists():
+        print(f"{golden}: no golden image, save one with `golden` or `ppm`")
+        return 1
+
+    width, height, expected = read_ppm(golden)
+
+    if (width, height) != (frame.width, frame.height):
+        print(f"size differs: captured {frame.width}x{frame.height}, golden {width}x{height}")
+        return 1
+
+    actual = frame.rgb()
+    mismatched = 0
+    marked = bytearray(actual)
+
+    for i in range(0, len(actual), 3):
+        if actual[i:i + 3] != expected[i:i + 3]:
+            mismatched += 1
+            marked[i:i + 3] = b"\xff\x00\xff"
+
+    if diff is not None:
+        write_ppm(diff, width, height, bytes(marked))
+
+    print(f"{mismatched} of {width * height} pixels differ")
+    return 0 if mismatched == 0 else 1
+
+
+def golden_set(frames: list[Frame]) -> list[tuple[str, Frame]]:
+    if len(frames) != len(GOLDEN):
+        raise SystemExit(f"{len(frames)} captures, expected {len(GOLDEN)}: {', '.join(GOLDEN)}")
+
+    return list(zip(GOLDEN, frames))
+
+
+def modes(framebuffer: list[Frame], strips: list[Frame]):
+    print(f"{'screen':<10} {'framebuffer us':>15} {'strips us':>10} {'strips/fb':>10}")
+
+    totals = [0, 0]
+    for (name, fb), (_, strip) in zip(golden_set(framebuffer), golden_set(strips)):
+        totals[0] += fb.frame_us
+        totals[1] += strip.frame_us
+        ratio = strip.frame_us / fb.frame_us if fb.frame_us else float("inf")
+        print(f"{name:<10} {fb.frame_us:15d} {strip.frame_us:10d} {ratio:10.2f}")
+
+    ratio = totals[1] / totals[0] if totals[0] else float("inf")
+    print(f"{'total':<10} {totals[0]:15d} {totals[1]:10d} {ratio:10.2f}")
+
+
+def main(args: list[str]):
+    if len(args) < 2 or args[0] not in ("ppm", "compare", "golden", "check", "bench", "modes"):
+        raise SystemExit(__doc__)
+
+    frames = load(Path(args[1]))
+    last = frames[-1]
+
+    if args[0] == "golden":
+        GOLDEN_DIR.mkdir(exist_ok=True)
+        for name, frame in golden_set(frames):
+            out = GOLDEN_DIR / f"{name}.ppm"
+            write_ppm(out, frame.width, frame.height, frame.rgb())
+            print(f"{out}: {frame.width}x{frame.height}")
+        return
+
+    if args[0] == "check":
+        failed = 0
+        for name, frame in golden_set(frames):
+            print(f"{name}: ", end="")
+            failed += compare(frame, GOLDEN_DIR / f"{name}.ppm", Path(f"{name}.diff.ppm"))
+        sys.exit(0 if failed == 0 else 1)
+
+    if args[0] == "bench":
+        print(f"{'#':>3} {'render us':>10} {'transfer us':>12} {'SPI bytes':>10}")
+        for index, frame in enumerate(frames):
+            print(f"{index:3d} {frame.render_us:10d} {frame.transfer_us:12d} {frame.spi_bytes:10d}")
+        return
+
+    if args[0] == "modes":
+        if len(args) < 3:
+            raise SystemExit(__doc__)
+        modes(frames, load(Path(args[2])))
+        return
+
+    if len(args) < 3:
+        raise SystemExit(__doc__)
+
+    if args[0] == "ppm":
+        out = Path(args[2])
+        write_ppm(out, last.width, last.height, last.rgb())
+        print(f"{out}: {last.width}x{last.height}, render {last.render_us} us, {last.spi_bytes} SPI bytes")
+        return
+
+    diff = Path(args[3]) if len(args) > 3 else None
+    sys.exit(compare(last, Path(args[2]), diff))
+
+
+if __name__ == "__main__":
+    main(sys.argv[1:])
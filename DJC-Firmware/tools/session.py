@@ -0,0 +1,126 @@
+"""
+ESP32-DJC session dump tool
+
+Extracts a session dumped over serial (`S` in the monitor with DJC_SESSION_RECORD)
+and either prints its records or generates the replay header for DJC_SESSION_REPLAY.
+
+Usage:
+    python tools/session.py print <monitor.log>
+    python tools/session.py header <monitor.log> [src/djc/diagnostics/ReplaySession.hpp]
+"""
+
+import re
+import struct
+import sys
+from pathlib import Path
+
+KINDS = ("Time", "Frame", "Button", "Receive", "ReceiveUnknown", "Send")
+
+HEADER_SIZE = 4
+
+_BEGIN = re.compile(r"begin (\d+) (\d+)\s*$")
+_LINE = re.compile(r"S ([0-9a-f]+)\s*$")
+
+
+def load(path: Path) -> tuple[int, bytes]:
+    """Return (start time, session bytes) of the last complete dump in the log"""
+    start = None
+    data = bytearray()
+    result = None
+
+    for line in path.read_text(encoding="utf-8", errors="ignore").splitlines():
+        if (m := _BEGIN.search(line)) is not None:
+            start = int(m.group(1))
+            data = bytearray()
+        elif start is not None and (m := _LINE.search(line)) is not None:
+            data += bytes.fromhex(m.group(1))
+        elif start is not None and line.rstrip().endswith("end"):
+            result = (start, bytes(data))
+            start = None
+
+    if result is None:
+        raise SystemExit(f"No complete session dump in {path}")
+
+    return result
+
+
+def records(start: int, data: bytes):
+    offset = 0
+    time = start
+    started = False
+
+    while offset + HEADER_SIZE <= len(data):
+        kind, delta, length = struct.unpack_from("<BHB", data, offset)
+        payload = data[offset + HEADER_SIZE: offset + HEADER_SIZE + length]
+        offset += HEADER_SIZE + length
+
+        if started:
+            time += delta
+        started = True
+
+        if KINDS[kind] == "Time":
+            time = struct.unpack("<I", payload)[0]
+            continue
+
+        yield time, KINDS[kind], payload
+
+
+def describe(kind: str, payload: bytes) -> str:
+    if kind == "Frame":
+        lx, ly, rx, ry, flags = struct.unpack("<hhhhB", payload)
+        return f"L({lx:+5d} {ly:+5d}) R({rx:+5d} {ry:+5d}) buttons={flags:04b}"
+
+    if kind == "Button":
+        return f"{('left', 'right')[payload[0]]} {'down' if payload[1] else 'up'}"
+
+    if kind == "ReceiveUnknown":
+        mac = ":".join(f"{b:02X}" for b in payload[:6])
+        return f"{mac} {payload[6:].hex()}"
+
+    return payload.hex()
+
+
+def write_header(start: int, data: bytes, out: Path):
+    rows = ",\n".join(
+        "    " + ", ".join(f"0x{b:02x}" for b in data[i: i + 16])
+        for i in range(0, len(data), 16)
+    )
+
+    out.write_text(
+        "// Generated by tools/session.py, do not edit\n"
+        "\n"
+        "#pragma once\n"
+        "\n"
+        "#include <kf/aliases.hpp>\n"
+        "\n"
+        "namespace djc::diagnostics {\n"
+        "\n"
+        f"constexpr kf::u32 replay_session_start{{{start}}};\n"
+        "\n"
+        "constexpr kf::u8 replay_session[] = {\n"
+        f"{rows}\n"
+        "};\n"
+        "\n"
+        "}// namespace djc::diagnostics\n",
+        encoding="utf-8",
+    )
+
+
+def main(args: list[str]):
+    if len(args) < 2 or args[0] not in ("print", "header"):
+        raise SystemExit(__doc__)
+
+    start, data = load(Path(args[1]))
+
+    if args[0] == "print":
+        for time, kind, payload in records(start, data):
+            print(f"{time:10d} {kind:<14} {describe(kind, payload)}")
+        return
+
+    out = Path(args[2]) if len(args) > 2 else Path("src/djc/diagnostics/ReplaySession.hpp")
+    write_header(start, data, out)
+    print(f"{out}: {len(data)} bytes, start {start} ms")
+
+
+if __name__ == "__main__":
+    main(sys.argv[1:])